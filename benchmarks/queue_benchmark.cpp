@@ -0,0 +1,176 @@
+/**
+ * @file queue_benchmark.cpp
+ * @brief Benchmark - Ring-buffer queues vs node-based linked queue
+ * 
+ * Replays the Round Robin access pattern (dequeue the running process,
+ * re-enqueue it after its quantum) on three queues:
+ *   - IndexQueue: the ring buffer of process indices Round Robin uses
+ *   - Queue: the ring buffer of whole Process entries
+ *   - the previous node-based queue (one malloc per enqueue)
+ * 
+ * Each implementation runs several times and the best time is reported.
+ * 
+ * Usage:
+ *   queue_benchmark [processes] [slices] [repeats]
+ */
+
+#include <chrono>
+#include <cstdlib>
+
+#include "../src/data_structures/queue.cpp"
+
+using namespace std;
+
+// ==========================================
+// Node-based queue (previous implementation, kept for comparison)
+// ==========================================
+struct NodeQueueNode {
+    Process data;
+    NodeQueueNode* next;
+};
+
+struct NodeQueue {
+    NodeQueueNode* front;
+    NodeQueueNode* rear;
+    int size;
+};
+
+NodeQueue* node_queue_create() {
+    NodeQueue* q = (NodeQueue*)malloc(sizeof(NodeQueue));
+    q->front = nullptr;
+    q->rear = nullptr;
+    q->size = 0;
+    return q;
+}
+
+void node_queue_destroy(NodeQueue* q) {
+    NodeQueueNode* current = q->front;
+    while (current) {
+        NodeQueueNode* temp = current;
+        current = current->next;
+        free(temp);
+    }
+    free(q);
+}
+
+void node_queue_enqueue(NodeQueue* q, Process p) {
+    NodeQueueNode* node = (NodeQueueNode*)malloc(sizeof(NodeQueueNode));
+    node->data = p;
+    node->next = nullptr;
+    if (q->size == 0) {
+        q->front = node;
+    } else {
+        q->rear->next = node;
+    }
+    q->rear = node;
+    q->size++;
+}
+
+Process node_queue_dequeue(NodeQueue* q) {
+    NodeQueueNode* temp = q->front;
+    Process data = temp->data;
+    q->front = temp->next;
+    if (!q->front) q->rear = nullptr;
+    free(temp);
+    q->size--;
+    return data;
+}
+
+// ==========================================
+// Benchmark Runs
+// ==========================================
+double bench_ring_queue(int processes, long long slices, unsigned long long* checksum) {
+    auto start = chrono::steady_clock::now();
+    Queue* q = queue_create();
+    for (int i = 0; i < processes; i++) {
+        queue_enqueue(q, create_process(i + 1, i, 10));
+    }
+    for (long long s = 0; s < slices; s++) {
+        Process p = queue_dequeue(q);
+        *checksum = *checksum * 31 + p.id;
+        queue_enqueue(q, p);
+    }
+    queue_destroy(q);
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// Same pattern on process indices, as round_robin.cpp does: the queue holds
+// the index and the process fields are read from the table
+double bench_index_queue(int processes, long long slices, unsigned long long* checksum) {
+    auto start = chrono::steady_clock::now();
+    int* ids = (int*)malloc(sizeof(int) * processes);
+    IndexQueue* q = index_queue_create();
+    for (int i = 0; i < processes; i++) {
+        ids[i] = i + 1;
+        index_queue_push(q, i);
+    }
+    for (long long s = 0; s < slices; s++) {
+        int index = index_queue_pop(q);
+        *checksum = *checksum * 31 + ids[index];
+        index_queue_push(q, index);
+    }
+    index_queue_destroy(q);
+    free(ids);
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+double bench_node_queue(int processes, long long slices, unsigned long long* checksum) {
+    auto start = chrono::steady_clock::now();
+    NodeQueue* q = node_queue_create();
+    for (int i = 0; i < processes; i++) {
+        node_queue_enqueue(q, create_process(i + 1, i, 10));
+    }
+    for (long long s = 0; s < slices; s++) {
+        Process p = node_queue_dequeue(q);
+        *checksum = *checksum * 31 + p.id;
+        node_queue_enqueue(q, p);
+    }
+    node_queue_destroy(q);
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// ==========================================
+// Main Function
+// ==========================================
+int main(int argc, char* argv[]) {
+    int processes = (argc > 1) ? atoi(argv[1]) : 1000;
+    long long slices = (argc > 2) ? atoll(argv[2]) : 10000000;
+    int repeats = (argc > 3) ? atoi(argv[3]) : 5;
+    if (processes < 1) processes = 1;
+    if (repeats < 1) repeats = 1;
+    
+    // Rolling hash of the dequeued ids (wraps on overflow), so a queue that
+    // returns the right processes in the wrong order is still caught
+    unsigned long long index_checksum = 0;
+    unsigned long long ring_checksum = 0;
+    unsigned long long node_checksum = 0;
+    double index_ms = 0;
+    double ring_ms = 0;
+    double node_ms = 0;
+    
+    // Interleave the runs so machine noise hits all implementations alike
+    for (int r = 0; r < repeats; r++) {
+        double ms = bench_index_queue(processes, slices, &index_checksum);
+        if (r == 0 || ms < index_ms) index_ms = ms;
+        ms = bench_ring_queue(processes, slices, &ring_checksum);
+        if (r == 0 || ms < ring_ms) ring_ms = ms;
+        ms = bench_node_queue(processes, slices, &node_checksum);
+        if (r == 0 || ms < node_ms) node_ms = ms;
+    }
+    
+    cout << "Queue benchmark: " << processes << " processes, " << slices << " slices, best of "
+         << repeats << endl;
+    cout << "  index queue : " << index_ms << " ms" << endl;
+    cout << "  ring buffer : " << ring_ms << " ms" << endl;
+    cout << "  linked nodes: " << node_ms << " ms" << endl;
+    if (index_ms > 0) {
+        cout << "  speedup (index queue vs linked nodes): " << node_ms / index_ms << "x" << endl;
+    }
+    
+    // All queues must dispatch the same processes in the same order
+    if (index_checksum != node_checksum || ring_checksum != node_checksum) {
+        cout << "Error: checksum mismatch" << endl;
+        return 1;
+    }
+    return 0;
+}
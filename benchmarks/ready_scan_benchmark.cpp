@@ -0,0 +1,381 @@
+/**
+ * @file ready_scan_benchmark.cpp
+ * @brief Benchmark - ready-set heap vs linear scan (scalar and SIMD)
+ *
+ * Runs the selection loops of SJF Non-Preemptive and SRTF for a range of
+ * table sizes with each way of picking the next ready process:
+ *   - heap  : MinHeap / IndexedHeap (what larger tables use)
+ *   - scalar: ready_scan_range over the window (what small tables use)
+ *   - simd  : AVX2 / SSE4.1 masked-argmin kernels over the window, picked
+ *             at runtime (kept here for comparison only)
+ *
+ * The heap/scalar crossover gives READY_SCAN_THRESHOLD in
+ * src/algorithms/ready_scan.cpp. The SIMD kernels are about 1.6-2x faster
+ * than the scalar scan on a window of 16-256 processes, but the fixed cost
+ * of merging the lanes keeps them slower than the heap at every table size,
+ * so the scheduler does not use them.
+ *
+ * Arrivals are spread so the CPU stays about fully loaded. Two input orders:
+ *   - sorted  : input already ordered by arrival (like the data/ files),
+ *               so the scan window is about the processes that are ready
+ *   - shuffled: random input order, so the window is close to the whole
+ *               table (the worst case for the scan)
+ *
+ * Usage:
+ *   ready_scan_benchmark [max_processes] [repeats]
+ */
+
+#include <chrono>
+#include <cstdlib>
+
+#include "../src/algorithms/sjf.cpp"
+
+using namespace std;
+
+// ==========================================
+// SIMD kernels (comparison only)
+// ==========================================
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_SCAN_X86 1
+#include <immintrin.h>
+
+// Each lane keeps the best (key, arrival, index) it has seen. The strict
+// comparison keeps the smaller index on ties because indices grow within
+// a lane. A remainder shorter than one step is covered by a last step that
+// overlaps the previous one and ends at end; a process seen twice is the
+// same candidate both times
+
+// Minimum of the 8 lanes, broadcast to every lane
+__attribute__((target("avx2")))
+inline __m256i simd_hmin_avx2(__m256i v) {
+    v = _mm256_min_epi32(v, _mm256_permute2x128_si256(v, v, 1));
+    v = _mm256_min_epi32(v, _mm256_shuffle_epi32(v, 0x4E));
+    return _mm256_min_epi32(v, _mm256_shuffle_epi32(v, 0xB1));
+}
+
+// AVX2: 8 processes per step (narrower windows use the scalar scan)
+__attribute__((target("avx2")))
+int simd_scan_avx2(const ProcessTable& table, const int key[], int now, int begin, int end) {
+    if (end - begin < 8) {
+        return ready_scan_range(table, key, now, begin, end);
+    }
+    const __m256i max_vec = _mm256_set1_epi32(INT_MAX);
+    const __m256i now_vec = _mm256_set1_epi32(now);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i none = _mm256_set1_epi32(-1);
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i best_key = max_vec;
+    __m256i best_arrival = max_vec;
+    __m256i best_index = none;
+    
+    for (int i = begin; i < end; i += 8) {
+        if (i + 8 > end) i = end - 8;
+        __m256i k = _mm256_loadu_si256((const __m256i*)(key + i));
+        __m256i a = _mm256_loadu_si256((const __m256i*)(table.arrival_time + i));
+        __m256i done = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(table.is_completed + i)));
+        
+        // eligible = not completed and arrival <= now
+        __m256i eligible = _mm256_andnot_si256(_mm256_cmpgt_epi32(a, now_vec), _mm256_cmpeq_epi32(done, zero));
+        
+        // A lane with no candidate yet takes any eligible process (even key INT_MAX)
+        __m256i better = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpgt_epi32(best_key, k), _mm256_cmpeq_epi32(best_index, none)),
+            _mm256_and_si256(_mm256_cmpeq_epi32(best_key, k), _mm256_cmpgt_epi32(best_arrival, a)));
+        better = _mm256_and_si256(better, eligible);
+        
+        best_key = _mm256_blendv_epi8(best_key, k, better);
+        best_arrival = _mm256_blendv_epi8(best_arrival, a, better);
+        best_index = _mm256_blendv_epi8(best_index, _mm256_add_epi32(_mm256_set1_epi32(i), lane), better);
+    }
+    
+    // Merge lanes: smallest key, then earliest arrival among those, then smallest index
+    __m256i found = _mm256_xor_si256(_mm256_cmpeq_epi32(best_index, none), none);
+    if (_mm256_testz_si256(found, found)) return -1;
+    __m256i candidates = _mm256_and_si256(found,
+        _mm256_cmpeq_epi32(best_key, simd_hmin_avx2(_mm256_blendv_epi8(max_vec, best_key, found))));
+    candidates = _mm256_and_si256(candidates,
+        _mm256_cmpeq_epi32(best_arrival, simd_hmin_avx2(_mm256_blendv_epi8(max_vec, best_arrival, candidates))));
+    return _mm256_cvtsi256_si32(simd_hmin_avx2(_mm256_blendv_epi8(max_vec, best_index, candidates)));
+}
+
+// Minimum of the 4 lanes, broadcast to every lane
+__attribute__((target("sse4.1")))
+inline __m128i simd_hmin_sse41(__m128i v) {
+    v = _mm_min_epi32(v, _mm_shuffle_epi32(v, 0x4E));
+    return _mm_min_epi32(v, _mm_shuffle_epi32(v, 0xB1));
+}
+
+// SSE4.1: 4 processes per step
+__attribute__((target("sse4.1")))
+int simd_scan_sse41(const ProcessTable& table, const int key[], int now, int begin, int end) {
+    if (end - begin < 4) {
+        return ready_scan_range(table, key, now, begin, end);
+    }
+    const __m128i max_vec = _mm_set1_epi32(INT_MAX);
+    const __m128i now_vec = _mm_set1_epi32(now);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i none = _mm_set1_epi32(-1);
+    const __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i best_key = max_vec;
+    __m128i best_arrival = max_vec;
+    __m128i best_index = none;
+    
+    for (int i = begin; i < end; i += 4) {
+        if (i + 4 > end) i = end - 4;
+        __m128i k = _mm_loadu_si128((const __m128i*)(key + i));
+        __m128i a = _mm_loadu_si128((const __m128i*)(table.arrival_time + i));
+        int flags;
+        memcpy(&flags, table.is_completed + i, sizeof(flags));
+        __m128i done = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(flags));
+        
+        __m128i eligible = _mm_andnot_si128(_mm_cmpgt_epi32(a, now_vec), _mm_cmpeq_epi32(done, zero));
+        
+        __m128i better = _mm_or_si128(
+            _mm_or_si128(_mm_cmpgt_epi32(best_key, k), _mm_cmpeq_epi32(best_index, none)),
+            _mm_and_si128(_mm_cmpeq_epi32(best_key, k), _mm_cmpgt_epi32(best_arrival, a)));
+        better = _mm_and_si128(better, eligible);
+        
+        best_key = _mm_blendv_epi8(best_key, k, better);
+        best_arrival = _mm_blendv_epi8(best_arrival, a, better);
+        best_index = _mm_blendv_epi8(best_index, _mm_add_epi32(_mm_set1_epi32(i), lane), better);
+    }
+    
+    __m128i found = _mm_xor_si128(_mm_cmpeq_epi32(best_index, none), none);
+    if (_mm_testz_si128(found, found)) return -1;
+    __m128i candidates = _mm_and_si128(found,
+        _mm_cmpeq_epi32(best_key, simd_hmin_sse41(_mm_blendv_epi8(max_vec, best_key, found))));
+    candidates = _mm_and_si128(candidates,
+        _mm_cmpeq_epi32(best_arrival, simd_hmin_sse41(_mm_blendv_epi8(max_vec, best_arrival, candidates))));
+    return _mm_cvtsi128_si32(simd_hmin_sse41(_mm_blendv_epi8(max_vec, best_index, candidates)));
+}
+
+#endif // SIMD_SCAN_X86
+
+int simd_scan_level() {
+#ifdef SIMD_SCAN_X86
+    static const int level = __builtin_cpu_supports("avx2") ? 2 : (__builtin_cpu_supports("sse4.1") ? 1 : 0);
+    return level;
+#else
+    return 0;
+#endif
+}
+
+// ==========================================
+// Selection Modes
+// ==========================================
+enum ScanMode { MODE_HEAP, MODE_SCALAR, MODE_SIMD };
+
+const char* MODE_NAMES[] = { "heap", "scalar", "simd" };
+
+int bench_scan(ScanMode mode, const ProcessTable& table, const int key[], int now, ReadyWindow& window) {
+    while (window.begin < window.end && table.is_completed[window.begin]) {
+        window.begin++;
+    }
+#ifdef SIMD_SCAN_X86
+    if (mode == MODE_SIMD) {
+        int level = simd_scan_level();
+        if (level == 2) return simd_scan_avx2(table, key, now, window.begin, window.end);
+        if (level == 1) return simd_scan_sse41(table, key, now, window.begin, window.end);
+    }
+#endif
+    return ready_scan_range(table, key, now, window.begin, window.end);
+}
+
+void table_reset(ProcessTable& table) {
+    for (int i = 0; i < table.count; i++) {
+        table.remaining_time[i] = table.burst_time[i];
+        table.is_completed[i] = 0;
+    }
+}
+
+// ==========================================
+// Selection Loops (same structure as sjf.cpp)
+// ==========================================
+unsigned long long run_sjf(ScanMode mode, ProcessTable& table, const int order[]) {
+    int count = table.count;
+    MinHeap<ByBurstTime>* ready = mode == MODE_HEAP ? heap_create<ByBurstTime>(count) : nullptr;
+    ReadyWindow window = ready_window_create();
+    unsigned long long checksum = 0;
+    int current_time = 0, completed = 0, next_arrival = 0;
+
+    while (completed < count) {
+        while (next_arrival < count && table.arrival_time[order[next_arrival]] <= current_time) {
+            if (ready) {
+                heap_push(ready, table, order[next_arrival]);
+            } else {
+                ready_window_admit(window, order[next_arrival]);
+            }
+            next_arrival++;
+        }
+
+        int idx = ready ? heap_pop(ready) : bench_scan(mode, table, table.burst_time, current_time, window);
+        if (idx == -1) {
+            current_time = table.arrival_time[order[next_arrival]];
+            continue;
+        }
+
+        checksum = checksum * 31 + idx;
+        table.is_completed[idx] = 1;
+        current_time += table.burst_time[idx];
+        completed++;
+    }
+
+    heap_destroy(ready);
+    return checksum;
+}
+
+unsigned long long run_srtf(ScanMode mode, ProcessTable& table, const int order[]) {
+    int count = table.count;
+    IndexedHeap<ByRemainingTime>* ready = mode == MODE_HEAP ? iheap_create<ByRemainingTime>(count) : nullptr;
+    ReadyWindow window = ready_window_create();
+    unsigned long long checksum = 0;
+    int current_time = 0, completed = 0, next_arrival = 0;
+
+    while (completed < count) {
+        while (next_arrival < count && table.arrival_time[order[next_arrival]] <= current_time) {
+            if (ready) {
+                iheap_push(ready, table, order[next_arrival]);
+            } else {
+                ready_window_admit(window, order[next_arrival]);
+            }
+            next_arrival++;
+        }
+
+        int idx = ready ? iheap_peek(ready) : bench_scan(mode, table, table.remaining_time, current_time, window);
+        if (idx == -1) {
+            current_time = table.arrival_time[order[next_arrival]];
+            continue;
+        }
+
+        int run_until = current_time + table.remaining_time[idx];
+        if (next_arrival < count && table.arrival_time[order[next_arrival]] < run_until) {
+            run_until = table.arrival_time[order[next_arrival]];
+        }
+        checksum = checksum * 31 + idx;
+        table.remaining_time[idx] -= run_until - current_time;
+        current_time = run_until;
+
+        if (table.remaining_time[idx] == 0) {
+            table.is_completed[idx] = 1;
+            completed++;
+            if (ready) iheap_pop(ready);
+        } else if (ready) {
+            iheap_decrease_key(ready, idx, table.remaining_time[idx]);
+        }
+    }
+
+    iheap_destroy(ready);
+    return checksum;
+}
+
+// ==========================================
+// Benchmark Runs
+// ==========================================
+typedef unsigned long long (*SelectionLoop)(ScanMode, ProcessTable&, const int[]);
+
+// Nanoseconds for `simulations` back-to-back runs of one selection loop
+double time_simulations(SelectionLoop loop, ScanMode mode, ProcessTable& table, const int order[],
+                        int simulations, unsigned long long* checksum) {
+    auto start = chrono::steady_clock::now();
+    for (int s = 0; s < simulations; s++) {
+        table_reset(table);
+        *checksum = loop(mode, table, order);
+    }
+    return chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+}
+
+// Best time per simulation in nanoseconds. Each sample runs enough
+// simulations to last at least 5 ms, so small tables are not lost in
+// timer resolution and large quadratic scans do not take minutes
+double bench_loop(SelectionLoop loop, ScanMode mode, ProcessTable& table, const int order[],
+                  int repeats, unsigned long long* checksum) {
+    int simulations = 1;
+    while (time_simulations(loop, mode, table, order, simulations, checksum) < 5e6) {
+        simulations *= 2;
+    }
+    double best = 0;
+    for (int r = 0; r < repeats; r++) {
+        double ns = time_simulations(loop, mode, table, order, simulations, checksum) / simulations;
+        if (r == 0 || ns < best) best = ns;
+    }
+    return best;
+}
+
+// Bursts 1..20, arrivals spread over the total work, ids in arrival order
+// when sorted is set and in random order otherwise
+Process* make_workload(int count, bool sorted) {
+    Process* processes = (Process*)malloc(sizeof(Process) * count);
+    int horizon = count * 10;
+    for (int i = 0; i < count; i++) {
+        processes[i] = create_process(i + 1, rand() % horizon, 1 + rand() % 20);
+    }
+    if (sorted) {
+        sort_processes_by_arrival(processes, count);
+    }
+    return processes;
+}
+
+bool bench_size(int count, bool sorted, int repeats) {
+    Process* processes = make_workload(count, sorted);
+    ProcessTable table = process_table_from_array(processes, count);
+    int* order = arrival_order_create(table);
+
+    SelectionLoop loops[] = { run_sjf, run_srtf };
+    bool ok = true;
+    cout << "  " << count;
+    for (int l = 0; l < 2; l++) {
+        unsigned long long checksums[3];
+        for (int m = 0; m < 3; m++) {
+            double ns = bench_loop(loops[l], (ScanMode)m, table, order, repeats, &checksums[m]);
+            cout << "\t" << (long long)(ns / count);
+        }
+        if (checksums[1] != checksums[0] || checksums[2] != checksums[0]) ok = false;
+    }
+    cout << endl;
+
+    arrival_order_destroy(order);
+    process_table_destroy(table);
+    free(processes);
+    return ok;
+}
+
+// ==========================================
+// Main Function
+// ==========================================
+int main(int argc, char* argv[]) {
+    int max_processes = (argc > 1) ? atoi(argv[1]) : 1024;
+    int repeats = (argc > 2) ? atoi(argv[2]) : 5;
+    if (max_processes < 4) max_processes = 4;
+    if (repeats < 1) repeats = 1;
+    srand(12345);
+
+    const char* levels[] = { "scalar only", "SSE4.1", "AVX2" };
+    cout << "Ready-set selection: ns per process, best of " << repeats
+         << " (SIMD: " << levels[simd_scan_level()] << ")" << endl;
+    bool ok = true;
+    for (int sorted = 1; sorted >= 0; sorted--) {
+        cout << (sorted ? "sorted input" : "shuffled input") << endl;
+        cout << "  n";
+        for (int l = 0; l < 2; l++) {
+            for (int m = 0; m < 3; m++) {
+                cout << "\t" << (l == 0 ? "sjf/" : "srtf/") << MODE_NAMES[m];
+            }
+        }
+        cout << endl;
+
+        // Powers of two and the midpoints between them
+        for (int count = 4; count <= max_processes; count *= 2) {
+            ok = bench_size(count, sorted, repeats) && ok;
+            if (count + count / 2 <= max_processes && count >= 8) {
+                ok = bench_size(count + count / 2, sorted, repeats) && ok;
+            }
+        }
+    }
+
+    // Every mode must pick the same processes in the same order
+    if (!ok) {
+        cout << "Error: checksum mismatch" << endl;
+        return 1;
+    }
+    return 0;
+}
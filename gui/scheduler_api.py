@@ -119,8 +119,10 @@ class CPUSchedulerAPI:
         else:
             lib_names = ["libcpu_scheduler.so"]
         
+        here = os.path.dirname(os.path.abspath(__file__))
         search_paths = [
             ".",
+            os.path.join(here, "..", "build", "lib"),
             "./lib",
             "./build/lib",
             "../lib",
@@ -190,8 +192,35 @@ class CPUSchedulerAPI:
         self._lib.api_get_timeline_length.argtypes = [c_void_p]
         self._lib.api_get_timeline_length.restype = c_int
         
+        self._lib.api_get_algorithm_name.argtypes = [c_void_p]
+        self._lib.api_get_algorithm_name.restype = c_char_p
+        
+        self._lib.api_get_process_count.argtypes = [c_void_p]
+        self._lib.api_get_process_count.restype = c_int
+        
+        # Bulk copies: 8 ints per process, 3 ints per timeline entry
+        self._lib.api_copy_processes.argtypes = [c_void_p, POINTER(c_int)]
+        self._lib.api_copy_processes.restype = None
+        
+        self._lib.api_copy_timeline.argtypes = [c_void_p, POINTER(c_int)]
+        self._lib.api_copy_timeline.restype = None
+        
         self._lib.api_free_result.argtypes = [c_void_p]
         self._lib.api_free_result.restype = None
+        
+        # Shared result cache (repeated workloads are not re-simulated)
+        for func_name in ['api_get_cache_hits', 'api_get_cache_misses']:
+            getattr(self._lib, func_name).argtypes = []
+            getattr(self._lib, func_name).restype = c_longlong
+        
+        self._lib.api_get_cache_entries.argtypes = []
+        self._lib.api_get_cache_entries.restype = c_int
+        
+        self._lib.api_set_cache_limit.argtypes = [c_longlong]
+        self._lib.api_set_cache_limit.restype = None
+        
+        self._lib.api_clear_cache.argtypes = []
+        self._lib.api_clear_cache.restype = None
     
     def run_algorithm(self, algorithm: Algorithm, processes: List[ProcessInput], 
                       time_quantum: int = 2) -> SchedulingResult:
@@ -223,29 +252,81 @@ class CPUSchedulerAPI:
     
     def run_fcfs(self, processes: List[ProcessInput]) -> SchedulingResult:
         """Run First Come First Serve algorithm"""
-        return self._run_algorithm_python("FCFS", processes, self._fcfs)
+        name = "FCFS"
+        if self._use_native and processes:
+            result = self._run_algorithm_native("api_run_fcfs", name, processes)
+            if result is not None:
+                return result
+        return self._run_algorithm_python(name, processes, self._fcfs)
     
     def run_sjf_non_preemptive(self, processes: List[ProcessInput]) -> SchedulingResult:
         """Run Shortest Job First (Non-Preemptive) algorithm"""
-        return self._run_algorithm_python("SJF Non-Preemptive", processes, self._sjf_np)
+        name = "SJF Non-Preemptive"
+        if self._use_native and processes:
+            result = self._run_algorithm_native("api_run_sjf_non_preemptive", name, processes)
+            if result is not None:
+                return result
+        return self._run_algorithm_python(name, processes, self._sjf_np)
     
     def run_sjf_preemptive(self, processes: List[ProcessInput]) -> SchedulingResult:
         """Run Shortest Job First (Preemptive/SRTF) algorithm"""
-        return self._run_algorithm_python("SJF Preemptive (SRTF)", processes, self._sjf_p)
+        name = "SJF Preemptive (SRTF)"
+        if self._use_native and processes:
+            result = self._run_algorithm_native("api_run_sjf_preemptive", name, processes)
+            if result is not None:
+                return result
+        return self._run_algorithm_python(name, processes, self._sjf_p)
     
     def run_priority_non_preemptive(self, processes: List[ProcessInput]) -> SchedulingResult:
         """Run Priority Scheduling (Non-Preemptive) algorithm"""
-        return self._run_algorithm_python("Priority Non-Preemptive", processes, self._priority_np)
+        name = "Priority Non-Preemptive"
+        if self._use_native and processes:
+            result = self._run_algorithm_native("api_run_priority_non_preemptive", name, processes)
+            if result is not None:
+                return result
+        return self._run_algorithm_python(name, processes, self._priority_np)
     
     def run_priority_preemptive(self, processes: List[ProcessInput]) -> SchedulingResult:
         """Run Priority Scheduling (Preemptive) algorithm"""
-        return self._run_algorithm_python("Priority Preemptive", processes, self._priority_p)
+        name = "Priority Preemptive"
+        if self._use_native and processes:
+            result = self._run_algorithm_native("api_run_priority_preemptive", name, processes)
+            if result is not None:
+                return result
+        return self._run_algorithm_python(name, processes, self._priority_p)
     
     def run_round_robin(self, processes: List[ProcessInput], time_quantum: int = 2) -> SchedulingResult:
         """Run Round Robin algorithm"""
-        return self._run_algorithm_python(f"Round Robin (Q={time_quantum})", processes, 
+        if time_quantum < 1:
+            raise ValueError(f"Time quantum must be at least 1, got {time_quantum}")
+        name = f"Round Robin (Q={time_quantum})"
+        if self._use_native and processes:
+            result = self._run_algorithm_native("api_run_round_robin", name, processes, time_quantum)
+            if result is not None:
+                return result
+        return self._run_algorithm_python(name, processes, 
                                           lambda p: self._round_robin(p, time_quantum))
     
+    def cache_stats(self) -> Dict[str, int]:
+        """Hit/miss counters of the C++ result cache (zeros without the library)"""
+        if not self._use_native:
+            return {"hits": 0, "misses": 0, "entries": 0}
+        return {
+            "hits": self._lib.api_get_cache_hits(),
+            "misses": self._lib.api_get_cache_misses(),
+            "entries": self._lib.api_get_cache_entries(),
+        }
+    
+    def set_cache_limit(self, limit_bytes: int):
+        """Memory bound of the result cache in bytes (0 disables it)"""
+        if self._use_native:
+            self._lib.api_set_cache_limit(limit_bytes)
+    
+    def clear_cache(self):
+        """Drop all cached results and reset the counters"""
+        if self._use_native:
+            self._lib.api_clear_cache()
+    
     def run_all_algorithms(self, processes: List[ProcessInput], 
                            time_quantum: int = 2) -> Dict[Algorithm, SchedulingResult]:
         """Run all scheduling algorithms and return results"""
@@ -276,6 +357,57 @@ class CPUSchedulerAPI:
         lines.append("=" * 70)
         return "\n".join(lines)
     
+    # ==========================================
+    # Native Implementation (libcpu_scheduler)
+    # ==========================================
+    
+    def _run_algorithm_native(self, func_name: str, name: str, processes: List[ProcessInput],
+                              *args) -> Optional[SchedulingResult]:
+        """
+        Run algorithm using the C++ library (None if the library rejected the input)
+        
+        The result is labelled with `name`, the same label the Python fallback
+        uses, so GUI labels do not depend on whether the library loaded
+        """
+        lib = self._lib
+        n = len(processes)
+        procs = lib.api_create_processes(n)
+        try:
+            for i, p in enumerate(processes):
+                lib.api_set_process(procs, i, p.id, p.arrival_time, p.burst_time, p.priority)
+            result = getattr(lib, func_name)(procs, n, *args)
+        finally:
+            lib.api_free_processes(procs)
+        
+        # ctypes maps a NULL c_void_p to None
+        if not result:
+            return None
+        
+        try:
+            count = lib.api_get_process_count(result)
+            rows = (c_int * (count * 8))()
+            lib.api_copy_processes(result, rows)
+            length = lib.api_get_timeline_length(result)
+            slices = (c_int * (length * 3))()
+            lib.api_copy_timeline(result, slices)
+            
+            return SchedulingResult(
+                algorithm_name=name,
+                processes=[
+                    ProcessResult(*rows[k * 8:(k + 1) * 8])
+                    for k in range(count)
+                ],
+                timeline=[
+                    TimelineEntry(*slices[k * 3:(k + 1) * 3])
+                    for k in range(length)
+                ],
+                avg_waiting_time=lib.api_get_avg_waiting_time(result),
+                avg_turnaround_time=lib.api_get_avg_turnaround_time(result),
+                cpu_utilization=lib.api_get_cpu_utilization(result),
+            )
+        finally:
+            lib.api_free_result(result)
+    
     # ==========================================
     # Python Implementation (Fallback)
     # ==========================================
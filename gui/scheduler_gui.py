@@ -1,7 +1,7 @@
 """
 CPU Scheduling Algorithms Simulator - GUI
 Using Flet Framework
-Connects to C++ backend via subprocess
+Connects to C++ backend via a persistent subprocess (--serve)
 """
 
 import warnings
@@ -9,6 +9,8 @@ warnings.filterwarnings("ignore", category=DeprecationWarning, module="flet")
 
 import flet as ft
 import subprocess
+import threading
+import queue
 import json
 import os
 from typing import List
@@ -41,6 +43,9 @@ COLORS = [
 # Path to C++ executable (sched2.exe in project root)
 CPP_EXE = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), "sched2.exe")
 
+# Seconds to wait for one reply before the server is considered hung
+CPP_TIMEOUT = 10
+
 # MinGW bin path (needed for DLLs at runtime)
 MINGW_BIN = r"F:\Program Files\JetBrains\CLion 2025.2.4\bin\mingw\bin"
 
@@ -65,37 +70,78 @@ class Process:
 
 
 # ============================================
-# C++ Backend Bridge (subprocess)
+# C++ Backend Bridge (persistent --serve process)
 # ============================================
-def call_cpp_scheduler(processes: List[Process], algo: int, quantum: int = 2) -> dict:
-    """Call C++ exe with --json mode and return parsed result"""
-    stdin_data = f"{len(processes)}\n"
-    for p in processes:
-        stdin_data += f"{p.arrival} {p.burst} {p.priority}\n"
-
-    cmd = [CPP_EXE, "--json", "--algo", str(algo), "--quantum", str(quantum)]
-    result = subprocess.run(cmd, input=stdin_data, capture_output=True, text=True, timeout=10, env=get_cpp_env())
+class CppServer:
+    """One long-lived `sched2.exe --serve` process, one request per line"""
+
+    def __init__(self):
+        self._proc = None
+        self._replies = None
+        self._lock = threading.Lock()
+
+    def _ensure_running(self):
+        if self._proc is None or self._proc.poll() is not None:
+            self._proc = subprocess.Popen(
+                [CPP_EXE, "--serve"], stdin=subprocess.PIPE, stdout=subprocess.PIPE,
+                text=True, bufsize=1, env=get_cpp_env())
+            # Reply lines are read on a separate thread so request() can wait
+            # with a deadline; each process gets its own queue
+            self._replies = queue.Queue()
+            threading.Thread(target=self._read_replies, args=(self._proc.stdout, self._replies),
+                             daemon=True).start()
+
+    @staticmethod
+    def _read_replies(stdout, replies):
+        for line in stdout:
+            replies.put(line)
+        replies.put("")
+
+    def _kill(self):
+        """Stop a hung server; the next request starts a fresh one"""
+        self._proc.kill()
+        self._proc.wait()
+        self._proc = None
+        self._replies = None
+
+    def request(self, algo: str, processes: List[Process], quantum: int):
+        """Send one request and parse its one-line JSON reply"""
+        fields = [algo, str(quantum), str(len(processes))]
+        for p in processes:
+            fields += [str(p.arrival), str(p.burst), str(p.priority)]
+
+        with self._lock:
+            self._ensure_running()
+            try:
+                self._proc.stdin.write(" ".join(fields) + "\n")
+                self._proc.stdin.flush()
+                reply = self._replies.get(timeout=CPP_TIMEOUT)
+            except queue.Empty:
+                self._kill()
+                raise RuntimeError(f"C++ server did not reply within {CPP_TIMEOUT} seconds")
+            except OSError:
+                reply = ""
+
+        if not reply:
+            raise RuntimeError("C++ server exited")
+        data = json.loads(reply)
+        if isinstance(data, dict) and "error" in data:
+            raise RuntimeError(f"C++ error: {data['error']}")
+        return data
+
+
+cpp_server = CppServer()
 
-    if result.returncode != 0:
-        raise RuntimeError(f"C++ error: {result.stderr}")
 
-    data = json.loads(result.stdout)
+def call_cpp_scheduler(processes: List[Process], algo: int, quantum: int = 2) -> dict:
+    """Run one algorithm on the C++ server and return the converted result"""
+    data = cpp_server.request(str(algo), processes, quantum)
     return convert_cpp_result(data, processes)
 
 
 def call_cpp_all(processes: List[Process], quantum: int = 2) -> List[dict]:
-    """Call C++ exe with --json --all and return all results"""
-    stdin_data = f"{len(processes)}\n"
-    for p in processes:
-        stdin_data += f"{p.arrival} {p.burst} {p.priority}\n"
-
-    cmd = [CPP_EXE, "--json", "--all", "--quantum", str(quantum)]
-    result = subprocess.run(cmd, input=stdin_data, capture_output=True, text=True, timeout=10, env=get_cpp_env())
-
-    if result.returncode != 0:
-        raise RuntimeError(f"C++ error: {result.stderr}")
-
-    data = json.loads(result.stdout)
+    """Run all algorithms on the C++ server and return all results"""
+    data = cpp_server.request("all", processes, quantum)
     return [convert_cpp_result(r, processes) for r in data]
 
 
@@ -196,6 +242,7 @@ def main(page: ft.Page):
             p.name = f"P{i + 1}"
             p.color = COLORS[i % len(COLORS)]
         update_process_list()
+        refresh_results()
 
     # Input fields
     arrival_input = ft.TextField(label="Arrival Time", width=120, value="0")
@@ -227,6 +274,7 @@ def main(page: ft.Page):
             burst_input.value = ""
             priority_input.value = ""
             update_process_list()
+            refresh_results()
         except ValueError:
             show_error("Enter valid numbers")
 
@@ -407,6 +455,17 @@ def main(page: ft.Page):
             border=ft.border.all(1, "#3a3a6a"),
         )
 
+    def refresh_results():
+        """Re-run the shown results after an edit (the server only
+        re-simulates from its last checkpoint before the change)"""
+        if not results_view.controls:
+            return
+        if processes:
+            run_algorithm(None)
+        else:
+            results_view.controls.clear()
+            page.update()
+
     def run_algorithm(e):
         if not processes:
             show_error("Add processes first!")
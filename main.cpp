@@ -12,7 +12,8 @@
  * - Statistics calculation
  */
 
-#include "src/api.cpp"
+#include "src/server.cpp"
+#include "src/stream.cpp"
 
 using namespace std;
 
@@ -26,7 +27,7 @@ void manual_input() {
     cout << "Number of processes: ";
     cin >> n;
     
-    if (n <= 0 || n > MAX_PROCESSES) {
+    if (n <= 0) {
         cout << "Invalid number!" << endl;
         return;
     }
@@ -41,7 +42,7 @@ void manual_input() {
         api_add_process(i + 1, arrival, burst, priority);
     }
     
-    print_processes(api_processes, api_process_count);
+    print_processes(api_session.processes, api_session.process_count);
 }
 
 // ==========================================
@@ -53,7 +54,7 @@ bool load_from_file() {
     cin >> filename;
     
     if (api_load_from_file(filename.c_str())) {
-        print_processes(api_processes, api_process_count);
+        print_processes(api_session.processes, api_session.process_count);
         return true;
     }
     return false;
@@ -63,7 +64,7 @@ bool load_from_file() {
 // Run Single Algorithm
 // ==========================================
 void run_single_algorithm(int algo) {
-    if (api_process_count == 0) {
+    if (api_session.process_count == 0) {
         cout << "No processes! Please add processes first." << endl;
         return;
     }
@@ -79,7 +80,7 @@ void run_single_algorithm(int algo) {
         }
     }
     
-    SchedulingResult* result = api_run_algorithm(algo, quantum);
+    const SchedulingResult* result = api_run_algorithm(algo, quantum);
     if (result) {
         api_print_result();
     }
@@ -149,7 +150,8 @@ int main(int argc, char* argv[]) {
     // Check for JSON mode first (no banner output)
     bool has_json = false;
     for (int i = 1; i < argc; i++) {
-        if (string(argv[i]) == "--json") { has_json = true; break; }
+        string arg = argv[i];
+        if (arg == "--json" || arg == "--serve" || arg == "--stream") { has_json = true; break; }
     }
     
     if (!has_json) {
@@ -169,7 +171,15 @@ int main(int argc, char* argv[]) {
             cout << "  scheduler --algo <1-6>       - Run specific algorithm" << endl;
             cout << "  scheduler --quantum <n>      - Set time quantum for RR" << endl;
             cout << "  scheduler --all              - Run all algorithms" << endl;
+            cout << "  scheduler --cpus <n>         - Simulate n CPUs (global run queue)" << endl;
+            cout << "  scheduler --per-cpu          - With --cpus: one run queue per CPU" << endl;
+            cout << "  scheduler --steal            - With --cpus: work-stealing deques (algo 1 or 6)" << endl;
             cout << "  scheduler --json             - Output results as JSON (for GUI)" << endl;
+            cout << "  scheduler --convert <in> <out.trace> - Convert a text workload to binary" << endl;
+            cout << "  scheduler --serve            - Answer one JSON request per stdin line" << endl;
+            cout << "  scheduler --serve --socket <path> - Same, on a Unix socket" << endl;
+            cout << "  scheduler --stream --algo <1-6> [--file <path>] - Schedule an arrival-ordered" << endl;
+            cout << "                               stream (stdin by default), one JSON event per line" << endl;
             cout << "\nAlgorithms:" << endl;
             cout << "  1 - FCFS" << endl;
             cout << "  2 - SJF Non-Preemptive" << endl;
@@ -185,6 +195,12 @@ int main(int argc, char* argv[]) {
         int quantum = DEFAULT_TIME_QUANTUM;
         bool run_all = false;
         bool json_mode = false;
+        int cpus = 1;
+        SmpQueueMode queue_mode = SMP_GLOBAL_QUEUE;
+        bool steal = false;
+        bool serve = false;
+        bool stream = false;
+        string socket_path = "";
         
         // JSON mode: --json <algo> <quantum> <count> <a1 b1 p1> <a2 b2 p2> ...
         for (int i = 1; i < argc; i++) {
@@ -199,9 +215,52 @@ int main(int argc, char* argv[]) {
                 quantum = stoi(argv[++i]);
             } else if (arg == "--all") {
                 run_all = true;
+            } else if (arg == "--cpus" && i + 1 < argc) {
+                cpus = stoi(argv[++i]);
+            } else if (arg == "--per-cpu") {
+                queue_mode = SMP_PER_CPU_QUEUES;
+            } else if (arg == "--steal") {
+                steal = true;
+            } else if (arg == "--serve") {
+                serve = true;
+            } else if (arg == "--stream") {
+                stream = true;
+            } else if (arg == "--socket" && i + 1 < argc) {
+                socket_path = argv[++i];
             }
         }
         
+        // Convert a text workload into a binary trace and exit
+        if (command == "--convert") {
+            if (argc < 4) {
+                cout << "Usage: scheduler --convert <input> <output.trace>" << endl;
+                return 1;
+            }
+            int count;
+            Process* loaded = load_processes_from_file(argv[2], &count);
+            bool ok = count >= 0 && trace_write(argv[3], loaded, count);
+            if (ok) {
+                cout << "Wrote " << count << " processes to " << argv[3] << endl;
+            }
+            free(loaded);
+            return ok ? 0 : 1;
+        }
+        
+        // Streaming mode: processes are scheduled as they are read
+        if (stream) {
+            return stream_run(algo, quantum, filename.empty() ? nullptr : filename.c_str(), stdout) ? 0 : 1;
+        }
+        
+        // Server mode: one request per line until EOF
+        if (serve) {
+            ServeOptions options = {cpus, queue_mode};
+            if (!socket_path.empty()) {
+                return serve_unix_socket(socket_path.c_str(), options) ? 0 : 1;
+            }
+            serve_stream(stdin, stdout, options);
+            return 0;
+        }
+        
         // JSON mode for GUI integration
         if (json_mode) {
             // Read processes from stdin: count, then each line: arrival burst priority
@@ -214,19 +273,29 @@ int main(int argc, char* argv[]) {
                 api_add_process(i + 1, arrival, burst, priority);
             }
             
-            if (run_all) {
-                cout << "[" << endl;
-                for (int a = 1; a <= 6; a++) {
-                    if (a == 6) quantum = quantum; // use provided quantum for RR
-                    api_run_algorithm(a, quantum);
-                    cout << api_get_result_json();
-                    if (a < 6) cout << ",";
+            // Results stream straight to stdout through a fixed buffer
+            JsonWriter out = json_writer_to_file(stdout);
+            if (steal) {
+                if (api_run_work_stealing(algo, quantum, cpus, nullptr)) {
+                    api_write_result_json(out);
                 }
-                cout << "]" << endl;
+            } else if (run_all) {
+                // All six run in parallel, each into its own result
+                SchedulingResult results[API_ALGORITHM_COUNT];
+                api_run_all_parallel(results, quantum, cpus, queue_mode);
+                json_literal(out, "[\n");
+                for (int t = 0; t < API_ALGORITHM_COUNT; t++) {
+                    write_result_json(out, results[t]);
+                    if (t < API_ALGORITHM_COUNT - 1) json_char(out, ',');
+                    result_destroy(results[t]);
+                }
+                json_literal(out, "]\n");
             } else if (algo >= 1 && algo <= 6) {
-                api_run_algorithm(algo, quantum);
-                cout << api_get_result_json();
+                api_run_algorithm(algo, quantum, cpus, queue_mode);
+                api_write_result_json(out);
             }
+            json_writer_destroy(out);
+            fflush(stdout);
             return 0;
         }
         
@@ -235,13 +304,21 @@ int main(int argc, char* argv[]) {
                 cout << "Failed to load file!" << endl;
                 return 1;
             }
-            print_processes(api_processes, api_process_count);
+            print_processes(api_session.processes, api_session.process_count);
         }
         
-        if (run_all) {
-            api_run_all_algorithms(quantum);
+        if (steal) {
+            WorkStealingReport report;
+            if (api_run_work_stealing(algo, quantum, cpus, &report)) {
+                api_print_result();
+                print_work_stealing_report(report);
+            } else {
+                cout << "Work stealing needs --algo 1 (FCFS) or --algo 6 (Round Robin)" << endl;
+            }
+        } else if (run_all) {
+            api_run_all_algorithms(quantum, cpus, queue_mode);
         } else if (algo >= 1 && algo <= 6) {
-            SchedulingResult* result = api_run_algorithm(algo, quantum);
+            const SchedulingResult* result = api_run_algorithm(algo, quantum, cpus, queue_mode);
             if (result) {
                 api_print_result();
             }
@@ -267,7 +344,7 @@ int main(int argc, char* argv[]) {
                 run_single_algorithm(choice - 2);  // 3->1, 4->2, etc.
                 break;
             case 9:
-                if (api_process_count > 0) {
+                if (api_session.process_count > 0) {
                     int q;
                     cout << "Time Quantum for Round Robin: ";
                     cin >> q;
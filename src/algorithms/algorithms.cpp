@@ -7,6 +7,11 @@
  * 2. SJF - Shortest Job First (Non-Preemptive & Preemptive)
  * 3. Priority - جدولة الأولوية (Non-Preemptive & Preemptive)
  * 4. Round Robin - الجدولة الدائرية
+ * 
+ * ومحاكاة نفس الخوارزميات على عدة معالجات (smp.cpp)
+ * وسرقة العمل بين طوابير المعالجات (work_stealing.cpp)
+ * والجدولة المتدفقة لعمليات تصل أثناء المحاكاة (online.cpp)
+ * وإعادة المحاكاة من آخر نقطة استئناف عند تعديل الحمل (incremental.cpp)
  */
 
 #ifndef ALGORITHMS_CPP_INCLUDED
@@ -17,6 +22,10 @@
 #include "sjf.cpp"
 #include "priority.cpp"
 #include "round_robin.cpp"
+#include "smp.cpp"
+#include "work_stealing.cpp"
+#include "online.cpp"
+#include "incremental.cpp"
 
 using namespace std;
 
@@ -26,7 +35,7 @@ using namespace std;
 void calculate_statistics(SchedulingResult& result) {
     double total_waiting = 0;
     double total_turnaround = 0;
-    int total_burst = 0;
+    long long total_burst = 0;
     int max_completion = 0;
     int min_arrival = (result.process_count > 0) ? result.processes[0].arrival_time : 0;
     
@@ -46,8 +55,31 @@ void calculate_statistics(SchedulingResult& result) {
     result.avg_waiting_time = (result.process_count > 0) ? total_waiting / result.process_count : 0;
     result.avg_turnaround_time = (result.process_count > 0) ? total_turnaround / result.process_count : 0;
     
-    int total_time = max_completion - min_arrival;
-    result.cpu_utilization = (total_time > 0) ? (double)total_burst / total_time * 100.0 : 0;
+    long long total_time = (long long)max_completion - min_arrival;
+    int cpu_count = (result.cpu_count > 1) ? result.cpu_count : 1;
+    result.cpu_utilization = (total_time > 0) ? (double)total_burst / ((double)total_time * cpu_count) * 100.0 : 0;
+    
+    // عدة معالجات: استخدام كل معالج، وعدم توازن الحمل
+    // (نسبة زيادة أكثر المعالجات انشغالاً عن المتوسط)
+    if (cpu_count > 1) {
+        long long* busy = (long long*)calloc(cpu_count, sizeof(long long));
+        for (int i = 0; i < result.timeline_length; i++) {
+            const ExecutionRecord& record = result.timeline[i];
+            busy[record.cpu_id] += record.end_time - record.start_time;
+        }
+        
+        free(result.cpu_utilizations);
+        result.cpu_utilizations = (double*)malloc(sizeof(double) * cpu_count);
+        long long max_busy = 0;
+        for (int cpu = 0; cpu < cpu_count; cpu++) {
+            result.cpu_utilizations[cpu] = (total_time > 0) ? (double)busy[cpu] / total_time * 100.0 : 0;
+            if (busy[cpu] > max_busy) max_busy = busy[cpu];
+        }
+        
+        double mean_busy = (double)total_burst / cpu_count;
+        result.load_imbalance = (mean_busy > 0) ? (max_busy - mean_busy) / mean_busy * 100.0 : 0;
+        free(busy);
+    }
 }
 
 #endif // ALGORITHMS_CPP_INCLUDED
@@ -0,0 +1,165 @@
+/**
+ * @file arrival_order.cpp
+ * @brief ترتيب العمليات حسب وقت الوصول
+ * 
+ * ينتج مصفوفة فهارس مرتبة حسب وقت الوصول بدون نقل العمليات نفسها
+ * تستخدمها الخوارزميات كمؤشر (cursor) على العملية التالية في الوصول
+ */
+
+#ifndef ARRIVAL_ORDER_CPP_INCLUDED
+#define ARRIVAL_ORDER_CPP_INCLUDED
+
+#include "../types.cpp"
+
+using namespace std;
+
+// ==========================================
+// التحقق من أن العمليات مرتبة حسب الوصول
+// ==========================================
+bool is_sorted_by_arrival(const Process processes[], int count) {
+    for (int i = 1; i < count; i++) {
+        if (processes[i].arrival_time < processes[i - 1].arrival_time) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// نفس التحقق على عمود أوقات الوصول
+bool is_sorted_by_arrival(const int arrival_time[], int count) {
+    for (int i = 1; i < count; i++) {
+        if (arrival_time[i] < arrival_time[i - 1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ==========================================
+// إنشاء ترتيب الوصول (Radix Sort مستقر على الفهارس)
+// ==========================================
+// الترتيب الحالي 0..count-1 (للإدخال المرتب مسبقاً)
+int* arrival_order_identity(int count) {
+    int* order = (int*)malloc(sizeof(int) * (count > 0 ? count : 1));
+    for (int i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    return order;
+}
+
+// المفاتيح منسوخة بجانب الفهارس حتى لا نقرأ العمليات في كل مرور
+// قلب بت الإشارة يجعل ترتيب الأعداد السالبة صحيحاً كأعداد بدون إشارة
+inline unsigned int arrival_radix_key(int arrival_time) {
+    return (unsigned int)arrival_time ^ 0x80000000u;
+}
+
+// LSD Radix Sort على مفاتيح وقت الوصول (8 بت في كل مرور) - O(n)
+// العمليات ذات وقت الوصول المتساوي تبقى بترتيب الإدخال
+// keys: مفاتيح arrival_radix_key لكل العمليات، وتحررها الدالة
+// بدون فحص الترتيب المسبق: المستدعي يفحصه مرة واحدة (count >= 2)
+int* arrival_order_radix(unsigned int* keys, int count) {
+    int* order = arrival_order_identity(count);
+    unsigned int* key_buffer = (unsigned int*)malloc(sizeof(unsigned int) * count);
+    int* buffer = (int*)malloc(sizeof(int) * count);
+    
+    int buckets[256];
+    for (int shift = 0; shift < 32; shift += 8) {
+        for (int b = 0; b < 256; b++) buckets[b] = 0;
+        for (int i = 0; i < count; i++) {
+            buckets[(keys[i] >> shift) & 0xFF]++;
+        }
+        
+        // تخطي المرور إذا كانت كل المفاتيح في نفس الخانة
+        if (buckets[(keys[0] >> shift) & 0xFF] == count) continue;
+        
+        int position = 0;
+        for (int b = 0; b < 256; b++) {
+            int size = buckets[b];
+            buckets[b] = position;
+            position += size;
+        }
+        for (int i = 0; i < count; i++) {
+            int slot = buckets[(keys[i] >> shift) & 0xFF]++;
+            key_buffer[slot] = keys[i];
+            buffer[slot] = order[i];
+        }
+        
+        unsigned int* temp_keys = keys;
+        keys = key_buffer;
+        key_buffer = temp_keys;
+        int* temp = order;
+        order = buffer;
+        buffer = temp;
+    }
+    
+    free(keys);
+    free(key_buffer);
+    free(buffer);
+    return order;
+}
+
+// بناء المفاتيح من عمود الوصول أو من مصفوفة العمليات مباشرة ثم الفرز
+int* arrival_order_radix(const int arrival_time[], int count) {
+    unsigned int* keys = (unsigned int*)malloc(sizeof(unsigned int) * count);
+    for (int i = 0; i < count; i++) {
+        keys[i] = arrival_radix_key(arrival_time[i]);
+    }
+    return arrival_order_radix(keys, count);
+}
+
+int* arrival_order_radix(const Process processes[], int count) {
+    unsigned int* keys = (unsigned int*)malloc(sizeof(unsigned int) * count);
+    for (int i = 0; i < count; i++) {
+        keys[i] = arrival_radix_key(processes[i].arrival_time);
+    }
+    return arrival_order_radix(keys, count);
+}
+
+// ترتيب الوصول لمفاتيح وقت الوصول
+// إذا كان الإدخال مرتباً مسبقاً يُعاد الترتيب الحالي بدون فرز
+int* arrival_order_from_keys(const int arrival_time[], int count) {
+    if (count < 2 || is_sorted_by_arrival(arrival_time, count)) {
+        return arrival_order_identity(count);
+    }
+    return arrival_order_radix(arrival_time, count);
+}
+
+// ترتيب الوصول لجدول عمليات (SoA)
+int* arrival_order_create(const ProcessTable& table) {
+    return arrival_order_from_keys(table.arrival_time, table.count);
+}
+
+// ترتيب الوصول لمصفوفة عمليات (AoS)
+int* arrival_order_create(const Process processes[], int count) {
+    if (count < 2 || is_sorted_by_arrival(processes, count)) {
+        return arrival_order_identity(count);
+    }
+    return arrival_order_radix(processes, count);
+}
+
+// ==========================================
+// ترتيب العمليات نفسها حسب الوصول
+// ==========================================
+// مرور واحد لنقل كل عملية مرة واحدة بدلاً من التبديلات المتكررة
+void sort_processes_by_arrival(Process processes[], int count) {
+    if (is_sorted_by_arrival(processes, count)) {
+        return;
+    }
+    
+    int* order = arrival_order_radix(processes, count);
+    Process* sorted = (Process*)malloc(sizeof(Process) * count);
+    for (int i = 0; i < count; i++) {
+        sorted[i] = processes[order[i]];
+    }
+    memcpy(processes, sorted, sizeof(Process) * count);
+    
+    free(sorted);
+    free(order);
+}
+
+// تحرير ترتيب الوصول
+void arrival_order_destroy(int* order) {
+    free(order);
+}
+
+#endif // ARRIVAL_ORDER_CPP_INCLUDED
@@ -9,9 +9,8 @@
 #ifndef FCFS_CPP_INCLUDED
 #define FCFS_CPP_INCLUDED
 
-#include <cstring>
-
 #include "../data_structures/queue.cpp"
+#include "arrival_order.cpp"
 
 using namespace std;
 
@@ -19,27 +18,11 @@ using namespace std;
 // FCFS - First Come First Serve
 // ==========================================
 SchedulingResult fcfs(Process processes[], int count) {
-    SchedulingResult result;
-    strcpy(result.algorithm_name, "FCFS (First Come First Serve)");
-    result.process_count = count;
-    result.timeline_length = 0;
-    
     // نسخ العمليات
-    for (int i = 0; i < count; i++) {
-        result.processes[i] = processes[i];
-        reset_process(result.processes[i]);
-    }
+    SchedulingResult result = result_create("FCFS (First Come First Serve)", processes, count);
     
-    // ترتيب حسب وقت الوصول (Bubble Sort)
-    for (int i = 0; i < count - 1; i++) {
-        for (int j = 0; j < count - i - 1; j++) {
-            if (result.processes[j].arrival_time > result.processes[j + 1].arrival_time) {
-                Process temp = result.processes[j];
-                result.processes[j] = result.processes[j + 1];
-                result.processes[j + 1] = temp;
-            }
-        }
-    }
+    // ترتيب حسب وقت الوصول (يُتخطى إذا كان الإدخال مرتباً)
+    sort_processes_by_arrival(result.processes, count);
     
     int current_time = 0;
     
@@ -57,10 +40,7 @@ SchedulingResult fcfs(Process processes[], int count) {
         result.processes[i].is_completed = true;
         
         // إضافة للجدول الزمني
-        result.timeline[result.timeline_length].process_id = result.processes[i].id;
-        result.timeline[result.timeline_length].start_time = current_time;
-        result.timeline[result.timeline_length].end_time = result.processes[i].completion_time;
-        result.timeline_length++;
+        push_execution_record(result, result.processes[i].id, current_time, result.processes[i].completion_time);
         
         current_time = result.processes[i].completion_time;
     }
@@ -0,0 +1,207 @@
+/**
+ * @file incremental.cpp
+ * @brief إعادة المحاكاة التدريجية عند إضافة أو حذف أو تعديل عمليات
+ *
+ * يحتفظ IncrementalRun بآخر حمل (مرتباً حسب الوصول) ونتائجه، وبنقاط
+ * استئناف (checkpoints) هي نسخ من حالة OnlineScheduler عند حدود التسليم.
+ * عند التشغيل التالي يُقارن الحمل الجديد بالسابق حسب ترتيب الوصول:
+ * أول موضع اختلاف d يحدد آخر نقطة استئناف قبله، والمحاكاة تُكمل منها
+ * فقط. إضافة عملية بوقت وصول t تعيد محاكاة ما بعد t تقريباً، لا الحمل كله.
+ *
+ * داخلياً تُعرّف العمليات برتبتها في ترتيب الوصول، وتُترجم الرتب إلى
+ * أرقام العمليات الحالية عند بناء النتيجة، فإعادة ترقيم العمليات (مثل
+ * الواجهة بعد الحذف) لا تُبطل ما سبق نقطة الاختلاف.
+ */
+
+#ifndef INCREMENTAL_CPP_INCLUDED
+#define INCREMENTAL_CPP_INCLUDED
+
+#include "online.cpp"
+#include "arrival_order.cpp"
+
+using namespace std;
+
+// أقل عدد تسليمات بين نقطتي استئناف. نسخ الحالة يكلف بقدر العمليات
+// الحية، لذلك تُؤخذ النقطة التالية بعد max(هذا العدد، العمليات الحية)
+// تسليماً: التكلفة الكلية للنقاط خطية في عدد العمليات
+const int INCREMENTAL_CHECKPOINT_INTERVAL = 1024;
+
+struct IncrementalCheckpoint {
+    int submitted;              // عدد العمليات المسلمة قبل النقطة
+    int timeline_length;        // طول الجدول الزمني عندها
+    OnlineScheduler* state;
+};
+
+struct IncrementalRun {
+    int algorithm_id;
+    int time_quantum;
+
+    // آخر حمل حسب رتبة الوصول
+    int count;
+    int capacity;
+    int* arrival_time;
+    int* burst_time;
+    int* priority;
+
+    // النتائج حسب الرتبة، والجدول الزمني (process_id = الرتبة)
+    int* start_time;
+    int* completion_time;
+    ExecutionRecord* timeline;
+    int timeline_length;
+    int timeline_capacity;
+
+    IncrementalCheckpoint* checkpoints;
+    int checkpoint_count;
+    int checkpoint_capacity;
+
+    int resumed_from;           // رتبة بداية إعادة المحاكاة في آخر تشغيل
+};
+
+// ==========================================
+// استقبال النتائج من المجدول
+// ==========================================
+void incremental_on_segment(const ExecutionRecord& record, void* context) {
+    IncrementalRun* run = (IncrementalRun*)context;
+    if (run->timeline_length >= run->timeline_capacity) {
+        run->timeline_capacity = (run->timeline_capacity > 0) ? run->timeline_capacity * 2 : 64;
+        run->timeline = (ExecutionRecord*)realloc(run->timeline, sizeof(ExecutionRecord) * run->timeline_capacity);
+    }
+    run->timeline[run->timeline_length++] = record;
+}
+
+void incremental_on_complete(const Process& process, void* context) {
+    IncrementalRun* run = (IncrementalRun*)context;
+    run->start_time[process.id] = process.start_time;
+    run->completion_time[process.id] = process.completion_time;
+}
+
+void incremental_add_checkpoint(IncrementalRun* run, int submitted, OnlineScheduler* state) {
+    if (run->checkpoint_count >= run->checkpoint_capacity) {
+        run->checkpoint_capacity = (run->checkpoint_capacity > 0) ? run->checkpoint_capacity * 2 : 16;
+        run->checkpoints = (IncrementalCheckpoint*)realloc(run->checkpoints,
+                                                           sizeof(IncrementalCheckpoint) * run->checkpoint_capacity);
+    }
+    IncrementalCheckpoint checkpoint = {submitted, run->timeline_length, state};
+    run->checkpoints[run->checkpoint_count++] = checkpoint;
+}
+
+// ==========================================
+// الواجهة
+// ==========================================
+
+// algorithm_id: نفس أرقام api_run_algorithm (1-6)، أو nullptr إذا كان غير صحيح
+IncrementalRun* incremental_create(int algorithm_id, int time_quantum) {
+    OnlineSink sink = {incremental_on_segment, incremental_on_complete, nullptr};
+    OnlineScheduler* initial = online_create(algorithm_id, time_quantum, sink);
+    if (!initial) {
+        return nullptr;
+    }
+    IncrementalRun* run = (IncrementalRun*)calloc(1, sizeof(IncrementalRun));
+    run->algorithm_id = algorithm_id;
+    run->time_quantum = time_quantum;
+    initial->sink.context = run;
+
+    // النقطة الأولى: الحالة الفارغة، فكل تشغيل له نقطة يبدأ منها
+    incremental_add_checkpoint(run, 0, initial);
+    return run;
+}
+
+void incremental_destroy(IncrementalRun* run) {
+    if (!run) return;
+    for (int c = 0; c < run->checkpoint_count; c++) {
+        online_destroy(run->checkpoints[c].state);
+    }
+    free(run->checkpoints);
+    free(run->arrival_time);
+    free(run->burst_time);
+    free(run->priority);
+    free(run->start_time);
+    free(run->completion_time);
+    free(run->timeline);
+    free(run);
+}
+
+// نفس نتيجة smp_run_single على processes، مع إعادة محاكاة ما بعد
+// أول اختلاف عن الحمل السابق فقط
+SchedulingResult incremental_run(IncrementalRun* run, const Process processes[], int count) {
+    int* keys = (int*)malloc(sizeof(int) * (count > 0 ? count : 1));
+    for (int i = 0; i < count; i++) {
+        keys[i] = processes[i].arrival_time;
+    }
+    int* order = arrival_order_from_keys(keys, count);
+    free(keys);
+
+    if (count > run->capacity) {
+        run->capacity = count;
+        run->arrival_time = (int*)realloc(run->arrival_time, sizeof(int) * count);
+        run->burst_time = (int*)realloc(run->burst_time, sizeof(int) * count);
+        run->priority = (int*)realloc(run->priority, sizeof(int) * count);
+        run->start_time = (int*)realloc(run->start_time, sizeof(int) * count);
+        run->completion_time = (int*)realloc(run->completion_time, sizeof(int) * count);
+    }
+
+    // أول رتبة يختلف فيها الحمل الجديد عن السابق
+    int same = (count < run->count) ? count : run->count;
+    int changed = 0;
+    while (changed < same) {
+        const Process& p = processes[order[changed]];
+        if (p.arrival_time != run->arrival_time[changed] || p.burst_time != run->burst_time[changed] ||
+            p.priority != run->priority[changed]) {
+            break;
+        }
+        changed++;
+    }
+    for (int r = changed; r < count; r++) {
+        const Process& p = processes[order[r]];
+        run->arrival_time[r] = p.arrival_time;
+        run->burst_time[r] = p.burst_time;
+        run->priority[r] = p.priority;
+    }
+    run->count = count;
+
+    // حذف النقاط التي تلي الاختلاف (النقطة الأولى تبقى دائماً)
+    while (run->checkpoint_count > 1 && run->checkpoints[run->checkpoint_count - 1].submitted > changed) {
+        online_destroy(run->checkpoints[--run->checkpoint_count].state);
+    }
+    const IncrementalCheckpoint& resume = run->checkpoints[run->checkpoint_count - 1];
+    run->timeline_length = resume.timeline_length;
+    run->resumed_from = resume.submitted;
+
+    OnlineScheduler* scheduler = online_clone(resume.state);
+    int last_checkpoint = resume.submitted;
+    for (int r = resume.submitted; r < count; r++) {
+        int live = online_live_count(scheduler);
+        int interval = (live > INCREMENTAL_CHECKPOINT_INTERVAL) ? live : INCREMENTAL_CHECKPOINT_INTERVAL;
+        if (r - last_checkpoint >= interval) {
+            incremental_add_checkpoint(run, r, online_clone(scheduler));
+            last_checkpoint = r;
+        }
+        online_submit(scheduler, create_process(r, run->arrival_time[r], run->burst_time[r], run->priority[r]));
+    }
+    online_finish(scheduler);
+    online_destroy(scheduler);
+
+    // بناء النتيجة بأرقام العمليات الحالية. FCFS و Round Robin يعيدان
+    // العمليات مرتبة حسب الوصول كما في نسختيهما الدفعيتين
+    SchedulingResult result = result_create(smp_algorithm_name(run->algorithm_id), processes, count);
+    bool arrival_ordered = run->algorithm_id == 1 || run->algorithm_id == 6;
+    for (int r = 0; r < count; r++) {
+        Process& p = result.processes[arrival_ordered ? r : order[r]];
+        if (arrival_ordered) p = processes[order[r]];
+        p.start_time = run->start_time[r];
+        p.completion_time = run->completion_time[r];
+        p.turnaround_time = p.completion_time - p.arrival_time;
+        p.waiting_time = p.turnaround_time - p.burst_time;
+        p.remaining_time = 0;
+        p.is_completed = true;
+    }
+    for (int i = 0; i < run->timeline_length; i++) {
+        const ExecutionRecord& record = run->timeline[i];
+        push_execution_record(result, processes[order[record.process_id]].id, record.start_time, record.end_time);
+    }
+
+    arrival_order_destroy(order);
+    return result;
+}
+
+#endif // INCREMENTAL_CPP_INCLUDED
@@ -0,0 +1,348 @@
+/**
+ * @file online.cpp
+ * @brief الجدولة المتدفقة (Online): العمليات تُضاف واحدة واحدة أثناء المحاكاة
+ *
+ * بدلاً من مصفوفة Process[] كاملة قبل البدء، تُسلّم العمليات بترتيب
+ * الوصول عبر online_submit، وتُرسل العمليات المنتهية وشرائح الجدول
+ * الزمني إلى OnlineSink فور معرفتها. الذاكرة تتناسب مع العمليات الحية
+ * (الجاهزة + الجارية) فقط، لا مع طول الأثر، فيمكن تشغيل سجلات وصول
+ * بطول أيام.
+ *
+ * الحدث عند الزمن t لا يُعالج حتى تصل عملية وقتها بعد t (أو online_finish)،
+ * لأن عملية أخرى قد تصل عند t نفسه وتغير القرار. بهذا تطابق النتائج
+ * الخوارزميات الدفعية (fcfs, sjf_*, priority_*, round_robin) تماماً.
+ */
+
+#ifndef ONLINE_CPP_INCLUDED
+#define ONLINE_CPP_INCLUDED
+
+#include "../data_structures/queue.cpp"
+#include "../data_structures/priority_queue.cpp"
+#include "smp.cpp"
+#include <climits>
+
+using namespace std;
+
+// ==========================================
+// المخرجات
+// ==========================================
+typedef void (*OnlineSegmentCallback)(const ExecutionRecord& record, void* context);
+typedef void (*OnlineCompleteCallback)(const Process& process, void* context);
+
+// أي دالة يمكن أن تكون nullptr
+struct OnlineSink {
+    OnlineSegmentCallback on_segment;
+    OnlineCompleteCallback on_complete;
+    void* context;
+};
+
+// إحصائيات تراكمية (نفس تعريفات calculate_statistics)
+struct OnlineStats {
+    long long completed;
+    double avg_waiting_time;
+    double avg_turnaround_time;
+    double cpu_utilization;
+    int peak_live;              // أكبر عدد عمليات حية في نفس الوقت
+};
+
+// ==========================================
+// حالة المجدول
+// ==========================================
+// العمليات الحية في خانات (slots) يعاد استخدامها بعد انتهاء العملية
+// الطابور الجاهز: IndexQueue للـ FCFS و Round Robin، و MinHeap للبقية
+// مفتاح الـ heap (المفتاح، رقم التسليم، الخانة): رقم التسليم يتبع ترتيب
+// الوصول ثم ترتيب الإدخال، فهو نفس كاسر التعادل (الوصول، الفهرس) الدفعي
+struct OnlineScheduler {
+    int algorithm_id;
+    int time_quantum;
+    OnlineSink sink;
+
+    Process* slots;
+    int* sequence;              // رقم التسليم لكل خانة
+    int* free_slots;
+    int free_count;
+    int capacity;
+    int live;
+    int next_sequence;          // يعود للصفر كلما فرغت العمليات الحية
+
+    IndexQueue* fifo;
+    MinHeap<LexicographicOrder>* ready;
+
+    int now;
+    int running;                // الخانة الجارية أو -1
+    int run_start;
+    int slice_end;
+    int last_arrival;
+    bool has_arrival;
+
+    // الشريحة الأخيرة تُحجز لدمجها مع التالية (السياسات الاستباقية فقط)
+    ExecutionRecord open_segment;
+    bool has_open_segment;
+
+    long long completed;
+    double total_waiting;
+    double total_turnaround;
+    long long total_burst;
+    int min_arrival;
+    int max_completion;
+    int peak_live;
+};
+
+// ==========================================
+// دوال مساعدة
+// ==========================================
+inline bool online_is_preemptive(const OnlineScheduler* s) {
+    return s->algorithm_id == 3 || s->algorithm_id == 5;
+}
+
+// مفتاح الخانة في الـ heap حسب السياسة
+inline HeapEntry online_entry(const OnlineScheduler* s, int slot) {
+    const Process& p = s->slots[slot];
+    int key = (s->algorithm_id == 2) ? p.burst_time
+            : (s->algorithm_id == 3) ? p.remaining_time
+            : p.priority;
+    HeapEntry e = {key, s->sequence[slot], slot};
+    return e;
+}
+
+void online_ready_push(OnlineScheduler* s, int slot) {
+    if (s->fifo) {
+        index_queue_push(s->fifo, slot);
+    } else {
+        heap_push_entry(s->ready, online_entry(s, slot));
+    }
+}
+
+int online_ready_pop(OnlineScheduler* s) {
+    if (s->fifo) {
+        return index_queue_pop(s->fifo);
+    }
+    return heap_pop(s->ready);
+}
+
+inline bool online_ready_is_empty(const OnlineScheduler* s) {
+    return s->fifo ? index_queue_is_empty(s->fifo) : heap_is_empty(s->ready);
+}
+
+void online_flush_segment(OnlineScheduler* s) {
+    if (!s->has_open_segment) return;
+    if (s->sink.on_segment) s->sink.on_segment(s->open_segment, s->sink.context);
+    s->has_open_segment = false;
+}
+
+// نفس سلوك push_execution_record / append_execution_record الدفعي
+void online_emit_segment(OnlineScheduler* s, int process_id, int start, int end) {
+    if (s->has_open_segment) {
+        ExecutionRecord& open = s->open_segment;
+        if (open.process_id == process_id && open.end_time == start) {
+            open.end_time = end;
+            return;
+        }
+        online_flush_segment(s);
+    }
+    ExecutionRecord record = {process_id, start, end, 0};
+    s->open_segment = record;
+    s->has_open_segment = true;
+    if (!online_is_preemptive(s)) online_flush_segment(s);
+}
+
+void online_complete(OnlineScheduler* s, int slot, int time) {
+    Process& p = s->slots[slot];
+    p.completion_time = time;
+    p.turnaround_time = p.completion_time - p.arrival_time;
+    p.waiting_time = p.turnaround_time - p.burst_time;
+    p.is_completed = true;
+
+    if (s->completed == 0 || p.arrival_time < s->min_arrival) s->min_arrival = p.arrival_time;
+    if (s->completed == 0 || time > s->max_completion) s->max_completion = time;
+    s->completed++;
+    s->total_waiting += p.waiting_time;
+    s->total_turnaround += p.turnaround_time;
+    s->total_burst += p.burst_time;
+
+    // شرائح العملية قبل إعلان انتهائها
+    online_flush_segment(s);
+    if (s->sink.on_complete) s->sink.on_complete(p, s->sink.context);
+
+    s->free_slots[s->free_count++] = slot;
+    s->live--;
+    if (s->live == 0) s->next_sequence = 0;
+}
+
+// إيقاف الشريحة الجارية عند time: تنتهي العملية أو تعود للطابور الجاهز
+void online_stop(OnlineScheduler* s, int time) {
+    int slot = s->running;
+    Process& p = s->slots[slot];
+    online_emit_segment(s, p.id, s->run_start, time);
+    p.remaining_time -= time - s->run_start;
+    s->now = time;
+    s->running = -1;
+
+    if (p.remaining_time == 0) {
+        online_complete(s, slot, time);
+    } else {
+        online_ready_push(s, slot);
+    }
+}
+
+void online_dispatch(OnlineScheduler* s) {
+    int slot = online_ready_pop(s);
+    Process& p = s->slots[slot];
+    if (p.start_time == -1) {
+        p.start_time = s->now;
+    }
+    int slice = p.remaining_time;
+    if (s->algorithm_id == 6 && slice > s->time_quantum) slice = s->time_quantum;
+    s->running = slot;
+    s->run_start = s->now;
+    s->slice_end = s->now + slice;
+}
+
+// معالجة كل الأحداث التي تسبق limit تماماً
+// (الأحداث عند limit تنتظر العمليات التي قد تصل عنده)
+void online_advance(OnlineScheduler* s, int limit) {
+    while (true) {
+        if (s->running != -1) {
+            if (s->slice_end >= limit) return;
+            online_stop(s, s->slice_end);
+        } else if (!online_ready_is_empty(s)) {
+            if (s->now >= limit) return;
+            online_dispatch(s);
+        } else {
+            return;
+        }
+    }
+}
+
+// خانة فارغة (تكبير المصفوفات عند الحاجة)
+int online_allocate_slot(OnlineScheduler* s) {
+    if (s->free_count == 0) {
+        int old_capacity = s->capacity;
+        s->capacity *= 2;
+        s->slots = (Process*)realloc(s->slots, sizeof(Process) * s->capacity);
+        s->sequence = (int*)realloc(s->sequence, sizeof(int) * s->capacity);
+        s->free_slots = (int*)realloc(s->free_slots, sizeof(int) * s->capacity);
+        for (int slot = s->capacity - 1; slot >= old_capacity; slot--) {
+            s->free_slots[s->free_count++] = slot;
+        }
+    }
+    return s->free_slots[--s->free_count];
+}
+
+// ==========================================
+// الواجهة
+// ==========================================
+
+// algorithm_id: نفس أرقام api_run_algorithm (1-6)، أو nullptr إذا كان غير صحيح
+OnlineScheduler* online_create(int algorithm_id, int time_quantum, OnlineSink sink) {
+    if (algorithm_id < 1 || algorithm_id > 6) {
+        return nullptr;
+    }
+    OnlineScheduler* s = (OnlineScheduler*)calloc(1, sizeof(OnlineScheduler));
+    s->algorithm_id = algorithm_id;
+    s->time_quantum = (time_quantum > 0) ? time_quantum : DEFAULT_TIME_QUANTUM;
+    s->sink = sink;
+
+    s->capacity = 64;
+    s->slots = (Process*)malloc(sizeof(Process) * s->capacity);
+    s->sequence = (int*)malloc(sizeof(int) * s->capacity);
+    s->free_slots = (int*)malloc(sizeof(int) * s->capacity);
+    for (int slot = s->capacity - 1; slot >= 0; slot--) {
+        s->free_slots[s->free_count++] = slot;
+    }
+
+    if (algorithm_id == 1 || algorithm_id == 6) {
+        s->fifo = index_queue_create();
+    } else {
+        s->ready = heap_create<LexicographicOrder>(s->capacity);
+    }
+
+    // مثل الخوارزميات الدفعية: الزمن يبدأ من 0
+    s->now = 0;
+    s->running = -1;
+    return s;
+}
+
+// تسليم العملية التالية. يعيد false (دون إضافتها) إذا كان وقت وصولها
+// أقل من وقت وصول العملية السابقة
+bool online_submit(OnlineScheduler* s, const Process& process) {
+    int arrival = process.arrival_time;
+    if (s->has_arrival && arrival < s->last_arrival) {
+        return false;
+    }
+    s->has_arrival = true;
+    s->last_arrival = arrival;
+
+    online_advance(s, arrival);
+
+    // السياسات الاستباقية: قطع الجارية عند الوصول، فتختار الجدولة
+    // عند arrival بين الجارية والواصلة (نفس نقاط القطع الدفعية)
+    if (s->running != -1 && online_is_preemptive(s)) {
+        online_stop(s, arrival);
+    }
+    if (s->running == -1 && online_ready_is_empty(s) && s->now < arrival) {
+        s->now = arrival;
+    }
+
+    int slot = online_allocate_slot(s);
+    s->slots[slot] = create_process(process.id, arrival, process.burst_time, process.priority);
+    s->sequence[slot] = s->next_sequence++;
+    s->live++;
+    if (s->live > s->peak_live) s->peak_live = s->live;
+    online_ready_push(s, slot);
+    return true;
+}
+
+// لا مزيد من العمليات: تنفيذ الباقي حتى النهاية
+void online_finish(OnlineScheduler* s) {
+    online_advance(s, INT_MAX);
+    online_flush_segment(s);
+}
+
+OnlineStats online_get_stats(const OnlineScheduler* s) {
+    OnlineStats stats;
+    stats.completed = s->completed;
+    stats.avg_waiting_time = (s->completed > 0) ? s->total_waiting / s->completed : 0;
+    stats.avg_turnaround_time = (s->completed > 0) ? s->total_turnaround / s->completed : 0;
+    long long total_time = (long long)s->max_completion - s->min_arrival;
+    stats.cpu_utilization = (total_time > 0) ? (double)s->total_burst / total_time * 100.0 : 0;
+    stats.peak_live = s->peak_live;
+    return stats;
+}
+
+const char* online_algorithm_name(const OnlineScheduler* s) {
+    return smp_algorithm_name(s->algorithm_id);
+}
+
+// نسخة مستقلة من الحالة كاملة (نقطة استئناف): تكلفتها تتناسب مع
+// العمليات الحية، ومتابعة التسليم على النسخة تعطي نفس النتائج
+OnlineScheduler* online_clone(const OnlineScheduler* s) {
+    OnlineScheduler* copy = (OnlineScheduler*)malloc(sizeof(OnlineScheduler));
+    *copy = *s;
+    copy->slots = (Process*)malloc(sizeof(Process) * s->capacity);
+    copy->sequence = (int*)malloc(sizeof(int) * s->capacity);
+    copy->free_slots = (int*)malloc(sizeof(int) * s->capacity);
+    memcpy(copy->slots, s->slots, sizeof(Process) * s->capacity);
+    memcpy(copy->sequence, s->sequence, sizeof(int) * s->capacity);
+    memcpy(copy->free_slots, s->free_slots, sizeof(int) * s->free_count);
+    copy->fifo = s->fifo ? index_queue_clone(s->fifo) : nullptr;
+    copy->ready = s->ready ? heap_clone(s->ready) : nullptr;
+    return copy;
+}
+
+// العمليات الحية الآن (الجاهزة + الجارية)
+int online_live_count(const OnlineScheduler* s) {
+    return s->live;
+}
+
+void online_destroy(OnlineScheduler* s) {
+    if (!s) return;
+    free(s->slots);
+    free(s->sequence);
+    free(s->free_slots);
+    if (s->fifo) index_queue_destroy(s->fifo);
+    heap_destroy(s->ready);
+    free(s);
+}
+
+#endif // ONLINE_CPP_INCLUDED
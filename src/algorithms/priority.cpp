@@ -4,12 +4,22 @@
  * 
  * جدولة حسب الأولوية (الرقم الأصغر = أولوية أعلى)
  * نسختين: Non-Preemptive و Preemptive
+ *
+ * كسر التعادل: عند تساوي الأولوية تُختار الأبكر وصولاً، ثم الأسبق في
+ * ترتيب الإدخال (ByPriority = priority, arrival, index). هذا نفس اختيار
+ * البديل المكتوب بـ Python في الواجهة (يرتب حسب الوصول ثم يأخذ أول أصغر
+ * أولوية). المسح الخطي القديم كان يأخذ الأسبق في الإدخال مباشرة دون
+ * النظر إلى الوصول، فقد تختلف النتائج عنه عند تساوي الأولوية
  */
 
 #ifndef PRIORITY_CPP_INCLUDED
 #define PRIORITY_CPP_INCLUDED
 
 #include "../data_structures/linked_list.cpp"
+#include "../data_structures/priority_queue.cpp"
+#include "../data_structures/indexed_heap.cpp"
+#include "arrival_order.cpp"
+#include "ready_scan.cpp"
 
 using namespace std;
 
@@ -17,115 +27,127 @@ using namespace std;
 // Priority Non-Preemptive
 // ==========================================
 SchedulingResult priority_non_preemptive(Process processes[], int count) {
-    SchedulingResult result;
-    strcpy(result.algorithm_name, "Priority (Non-Preemptive)");
-    result.process_count = count;
-    result.timeline_length = 0;
+    SchedulingResult result = result_create("Priority (Non-Preemptive)", processes, count);
     
-    for (int i = 0; i < count; i++) {
-        result.processes[i] = processes[i];
-        reset_process(result.processes[i]);
-    }
+    // الخوارزمية تعمل على جدول أعمدة (SoA)، مع مؤشر حسب الوصول وطابور أولوية للجاهزة
+    ProcessTable table = process_table_from_array(result.processes, count);
+    int* order = arrival_order_create(table);
+    // الجداول الصغيرة تُختار منها العملية بمسح خطي على الأعمدة بدل الـ heap
+    MinHeap<ByPriority>* ready = count > READY_SCAN_THRESHOLD ? heap_create<ByPriority>(count) : nullptr;
     
     int current_time = 0;
     int completed = 0;
+    int next_arrival = 0;
+    ReadyWindow window = ready_window_create();
     
     while (completed < count) {
-        // البحث عن العملية ذات الأولوية الأعلى (الرقم الأصغر)
-        int highest_idx = -1;
-        int highest_priority = 999999;
-        
-        for (int i = 0; i < count; i++) {
-            if (!result.processes[i].is_completed &&
-                result.processes[i].arrival_time <= current_time &&
-                result.processes[i].priority < highest_priority) {
-                highest_priority = result.processes[i].priority;
-                highest_idx = i;
+        // إضافة العمليات التي وصلت
+        while (next_arrival < count && table.arrival_time[order[next_arrival]] <= current_time) {
+            if (ready) {
+                heap_push(ready, table, order[next_arrival]);
+            } else {
+                ready_window_admit(window, order[next_arrival]);
             }
+            next_arrival++;
         }
         
-        if (highest_idx == -1) {
-            current_time++;
+        // العملية ذات الأولوية الأعلى (الرقم الأصغر)
+        int idx = ready ? heap_pop(ready) : ready_scan_argmin(table, table.priority, current_time, window);
+        
+        // لا توجد عملية متاحة: القفز مباشرة إلى الوصول التالي
+        if (idx == -1) {
+            current_time = table.arrival_time[order[next_arrival]];
             continue;
         }
         
-        Process& p = result.processes[highest_idx];
-        p.start_time = current_time;
-        p.completion_time = current_time + p.burst_time;
-        p.turnaround_time = p.completion_time - p.arrival_time;
-        p.waiting_time = p.turnaround_time - p.burst_time;
-        p.is_completed = true;
+        table.start_time[idx] = current_time;
+        table.completion_time[idx] = current_time + table.burst_time[idx];
+        table.turnaround_time[idx] = table.completion_time[idx] - table.arrival_time[idx];
+        table.waiting_time[idx] = table.turnaround_time[idx] - table.burst_time[idx];
+        table.is_completed[idx] = 1;
         
-        result.timeline[result.timeline_length].process_id = p.id;
-        result.timeline[result.timeline_length].start_time = current_time;
-        result.timeline[result.timeline_length].end_time = p.completion_time;
-        result.timeline_length++;
+        push_execution_record(result, table.id[idx], current_time, table.completion_time[idx]);
         
-        current_time = p.completion_time;
+        current_time = table.completion_time[idx];
         completed++;
     }
     
+    process_table_to_array(table, result.processes);
+    process_table_destroy(table);
+    arrival_order_destroy(order);
+    heap_destroy(ready);
     return result;
 }
 
 // ==========================================
 // Priority Preemptive
 // ==========================================
+// محاكاة مبنية على الأحداث: لا تتغير العملية الجارية إلا عند وصول عملية
+// جديدة أو انتهاء الجارية، لذلك يقفز الزمن بين هذه الأحداث مباشرة
 SchedulingResult priority_preemptive(Process processes[], int count) {
-    SchedulingResult result;
-    strcpy(result.algorithm_name, "Priority (Preemptive)");
-    result.process_count = count;
-    result.timeline_length = 0;
+    SchedulingResult result = result_create("Priority (Preemptive)", processes, count);
     
-    for (int i = 0; i < count; i++) {
-        result.processes[i] = processes[i];
-        reset_process(result.processes[i]);
-    }
+    // مؤشر على العمليات حسب الوصول، والعمليات الجاهزة حسب الأولوية
+    ProcessTable table = process_table_from_array(result.processes, count);
+    int* order = arrival_order_create(table);
+    // كما في النسخة غير الاستباقية: مسح خطي للجداول الصغيرة
+    IndexedHeap<ByPriority>* ready = count > READY_SCAN_THRESHOLD ? iheap_create<ByPriority>(count) : nullptr;
     
     int current_time = 0;
     int completed = 0;
+    int next_arrival = 0;
+    ReadyWindow window = ready_window_create();
     
     while (completed < count) {
-        int highest_idx = -1;
-        int highest_priority = 999999;
-        
-        for (int i = 0; i < count; i++) {
-            if (!result.processes[i].is_completed &&
-                result.processes[i].arrival_time <= current_time &&
-                result.processes[i].priority < highest_priority) {
-                highest_priority = result.processes[i].priority;
-                highest_idx = i;
+        // نقل العمليات التي وصلت إلى الطابور الجاهز
+        while (next_arrival < count && table.arrival_time[order[next_arrival]] <= current_time) {
+            if (ready) {
+                iheap_push(ready, table, order[next_arrival]);
+            } else {
+                ready_window_admit(window, order[next_arrival]);
             }
+            next_arrival++;
         }
         
-        if (highest_idx == -1) {
-            current_time++;
+        // العملية الجارية تبقى في الـ heap طوال تنفيذها
+        int idx = ready ? iheap_peek(ready) : ready_scan_argmin(table, table.priority, current_time, window);
+        
+        // المعالج خامل: القفز مباشرة إلى الوصول التالي
+        if (idx == -1) {
+            current_time = table.arrival_time[order[next_arrival]];
             continue;
         }
         
-        Process& p = result.processes[highest_idx];
-        if (p.start_time == -1) {
-            p.start_time = current_time;
+        if (table.start_time[idx] == -1) {
+            table.start_time[idx] = current_time;
+        }
+        
+        // التنفيذ حتى الانتهاء أو حتى وصول عملية جديدة قد تستبقها
+        int run_until = current_time + table.remaining_time[idx];
+        if (next_arrival < count && table.arrival_time[order[next_arrival]] < run_until) {
+            run_until = table.arrival_time[order[next_arrival]];
         }
         
-        // تسجيل كل وحدة زمنية كـ entry منفصلة
-        result.timeline[result.timeline_length].process_id = p.id;
-        result.timeline[result.timeline_length].start_time = current_time;
-        result.timeline[result.timeline_length].end_time = current_time + 1;
-        result.timeline_length++;
+        // دمج الشريحة مع السابقة إذا استمرت نفس العملية
+        append_execution_record(result, table.id[idx], current_time, run_until);
         
-        p.remaining_time--;
-        current_time++;
+        table.remaining_time[idx] -= run_until - current_time;
+        current_time = run_until;
         
-        if (p.remaining_time == 0) {
-            p.completion_time = current_time;
-            p.turnaround_time = p.completion_time - p.arrival_time;
-            p.waiting_time = p.turnaround_time - p.burst_time;
-            p.is_completed = true;
+        if (table.remaining_time[idx] == 0) {
+            table.completion_time[idx] = current_time;
+            table.turnaround_time[idx] = table.completion_time[idx] - table.arrival_time[idx];
+            table.waiting_time[idx] = table.turnaround_time[idx] - table.burst_time[idx];
+            table.is_completed[idx] = 1;
             completed++;
+            if (ready) iheap_pop(ready);
         }
     }
     
+    process_table_to_array(table, result.processes);
+    process_table_destroy(table);
+    arrival_order_destroy(order);
+    iheap_destroy(ready);
     return result;
 }
 
@@ -0,0 +1,92 @@
+/**
+ * @file ready_scan.cpp
+ * @brief اختيار العملية الجاهزة التالية بمسح خطي (الجداول الصغيرة)
+ * 
+ * المسح المقنّع (masked argmin) المشترك بين SJF و SRTF و Priority:
+ * من بين العمليات غير المكتملة التي وصلت (arrival <= now)
+ * اختر صاحبة أصغر مفتاح، ثم أبكر وصول، ثم أصغر فهرس
+ * (نفس ترتيب سياسات الـ heap في priority_queue.cpp)
+ * 
+ * يعمل على أعمدة ProcessTable مباشرة. يُستخدم فقط حتى READY_SCAN_THRESHOLD
+ * عملية، والجداول الأكبر تستخدم الـ heap. القياس في
+ * benchmarks/ready_scan_benchmark.cpp: نسخة متجهة (AVX2/SSE4.1) أسرع من
+ * المسح العادي لكنها تبقى أبطأ من الـ heap عند كل الأحجام، فلا تُستخدم
+ */
+
+#ifndef READY_SCAN_CPP_INCLUDED
+#define READY_SCAN_CPP_INCLUDED
+
+#include <climits>
+
+#include "../types.cpp"
+
+using namespace std;
+
+// ==========================================
+// الثوابت
+// ==========================================
+// حتى هذا العدد من العمليات يكون المسح أرخص من صيانة heap (مقاس بالـ benchmark)
+const int READY_SCAN_THRESHOLD = 16;
+
+// ==========================================
+// دوال مساعدة داخلية
+// ==========================================
+
+// هل المرشح (key, arrival, index) أفضل من الأفضل الحالي؟
+inline bool ready_scan_better(int key, int arrival, int index, int best_key, int best_arrival, int best_index) {
+    if (best_index == -1) return true;
+    if (key != best_key) return key < best_key;
+    if (arrival != best_arrival) return arrival < best_arrival;
+    return index < best_index;
+}
+
+// المسح على المجال [begin, end)
+inline int ready_scan_range(const ProcessTable& table, const int key[], int now, int begin, int end) {
+    int best_index = -1, best_key = INT_MAX, best_arrival = INT_MAX;
+    for (int i = begin; i < end; i++) {
+        if (table.is_completed[i] || table.arrival_time[i] > now) continue;
+        if (ready_scan_better(key[i], table.arrival_time[i], i, best_key, best_arrival, best_index)) {
+            best_index = i;
+            best_key = key[i];
+            best_arrival = table.arrival_time[i];
+        }
+    }
+    return best_index;
+}
+
+// ==========================================
+// نافذة المسح
+// ==========================================
+// المسح يقتصر على المجال [begin, end) من الجدول: end بعد أكبر فهرس وصل،
+// و begin عند أول عملية غير مكتملة. إذا كان الإدخال مرتباً حسب الوصول
+// تصبح النافذة هي العمليات الجاهزة تقريباً بدلاً من الجدول كله
+struct ReadyWindow {
+    int begin;
+    int end;
+};
+
+ReadyWindow ready_window_create() {
+    ReadyWindow window;
+    window.begin = 0;
+    window.end = 0;
+    return window;
+}
+
+// تسجيل وصول العملية index
+void ready_window_admit(ReadyWindow& window, int index) {
+    if (index >= window.end) window.end = index + 1;
+}
+
+// ==========================================
+// اختيار العملية الجاهزة التالية
+// ==========================================
+// key: عمود المفتاح (burst_time أو remaining_time أو priority)
+// يعيد فهرس العملية أو -1 إذا لم تصل أي عملية غير مكتملة
+int ready_scan_argmin(const ProcessTable& table, const int key[], int now, ReadyWindow& window) {
+    while (window.begin < window.end && table.is_completed[window.begin]) {
+        window.begin++;
+    }
+    return ready_scan_range(table, key, now, window.begin, window.end);
+}
+
+#endif // READY_SCAN_CPP_INCLUDED
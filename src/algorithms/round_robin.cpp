@@ -10,6 +10,7 @@
 #define ROUND_ROBIN_CPP_INCLUDED
 
 #include "../data_structures/stack.cpp"
+#include "arrival_order.cpp"
 
 using namespace std;
 
@@ -17,45 +18,29 @@ using namespace std;
 // Round Robin
 // ==========================================
 SchedulingResult round_robin(Process processes[], int count, int time_quantum = DEFAULT_TIME_QUANTUM) {
-    SchedulingResult result;
-    strcpy(result.algorithm_name, "Round Robin");
-    result.process_count = count;
-    result.timeline_length = 0;
+    SchedulingResult result = result_create("Round Robin", processes, count);
     
-    for (int i = 0; i < count; i++) {
-        result.processes[i] = processes[i];
-        reset_process(result.processes[i]);
-    }
-    
-    // ترتيب حسب وقت الوصول
-    for (int i = 0; i < count - 1; i++) {
-        for (int j = 0; j < count - i - 1; j++) {
-            if (result.processes[j].arrival_time > result.processes[j + 1].arrival_time) {
-                Process temp = result.processes[j];
-                result.processes[j] = result.processes[j + 1];
-                result.processes[j + 1] = temp;
-            }
-        }
-    }
+    // ترتيب حسب وقت الوصول (يُتخطى إذا كان الإدخال مرتباً)
+    sort_processes_by_arrival(result.processes, count);
     
-    // استخدام الطابور
-    Queue* ready_queue = queue_create();
+    // الطابور يحمل فهارس العمليات في result.processes فقط
+    IndexQueue* ready_queue = index_queue_create();
     int current_time = 0;
     int completed = 0;
     int next_arrival = 0;
     
     // إضافة العمليات الأولى
     while (next_arrival < count && result.processes[next_arrival].arrival_time <= current_time) {
-        queue_enqueue(ready_queue, result.processes[next_arrival]);
+        index_queue_push(ready_queue, next_arrival);
         next_arrival++;
     }
     
     while (completed < count) {
-        if (queue_is_empty(ready_queue)) {
+        if (index_queue_is_empty(ready_queue)) {
             if (next_arrival < count) {
                 current_time = result.processes[next_arrival].arrival_time;
                 while (next_arrival < count && result.processes[next_arrival].arrival_time <= current_time) {
-                    queue_enqueue(ready_queue, result.processes[next_arrival]);
+                    index_queue_push(ready_queue, next_arrival);
                     next_arrival++;
                 }
             } else {
@@ -63,52 +48,40 @@ SchedulingResult round_robin(Process processes[], int count, int time_quantum =
             }
         }
         
-        Process current = queue_dequeue(ready_queue);
-        
-        // البحث عن الفهرس في المصفوفة
-        int idx = -1;
-        for (int i = 0; i < count; i++) {
-            if (result.processes[i].id == current.id) {
-                idx = i;
-                break;
-            }
-        }
+        int idx = index_queue_pop(ready_queue);
+        Process& current = result.processes[idx];
         
-        if (result.processes[idx].start_time == -1) {
-            result.processes[idx].start_time = current_time;
+        if (current.start_time == -1) {
+            current.start_time = current_time;
         }
         
         // تنفيذ لمدة quantum أو حتى الانتهاء
         int exec_time = (current.remaining_time < time_quantum) ? current.remaining_time : time_quantum;
         
-        result.timeline[result.timeline_length].process_id = current.id;
-        result.timeline[result.timeline_length].start_time = current_time;
-        result.timeline[result.timeline_length].end_time = current_time + exec_time;
-        result.timeline_length++;
+        push_execution_record(result, current.id, current_time, current_time + exec_time);
         
         current_time += exec_time;
-        result.processes[idx].remaining_time -= exec_time;
+        current.remaining_time -= exec_time;
         
         // إضافة العمليات الجديدة التي وصلت
         while (next_arrival < count && result.processes[next_arrival].arrival_time <= current_time) {
-            queue_enqueue(ready_queue, result.processes[next_arrival]);
+            index_queue_push(ready_queue, next_arrival);
             next_arrival++;
         }
         
         // إعادة العملية للطابور إذا لم تنتهي
-        if (result.processes[idx].remaining_time > 0) {
-            Process updated = result.processes[idx];
-            queue_enqueue(ready_queue, updated);
+        if (current.remaining_time > 0) {
+            index_queue_push(ready_queue, idx);
         } else {
-            result.processes[idx].completion_time = current_time;
-            result.processes[idx].turnaround_time = result.processes[idx].completion_time - result.processes[idx].arrival_time;
-            result.processes[idx].waiting_time = result.processes[idx].turnaround_time - result.processes[idx].burst_time;
-            result.processes[idx].is_completed = true;
+            current.completion_time = current_time;
+            current.turnaround_time = current.completion_time - current.arrival_time;
+            current.waiting_time = current.turnaround_time - current.burst_time;
+            current.is_completed = true;
             completed++;
         }
     }
     
-    queue_destroy(ready_queue);
+    index_queue_destroy(ready_queue);
     return result;
 }
 
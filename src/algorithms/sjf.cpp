@@ -10,6 +10,9 @@
 #define SJF_CPP_INCLUDED
 
 #include "../data_structures/priority_queue.cpp"
+#include "../data_structures/indexed_heap.cpp"
+#include "arrival_order.cpp"
+#include "ready_scan.cpp"
 
 using namespace std;
 
@@ -17,117 +20,130 @@ using namespace std;
 // SJF Non-Preemptive
 // ==========================================
 SchedulingResult sjf_non_preemptive(Process processes[], int count) {
-    SchedulingResult result;
-    strcpy(result.algorithm_name, "SJF (Non-Preemptive)");
-    result.process_count = count;
-    result.timeline_length = 0;
+    SchedulingResult result = result_create("SJF (Non-Preemptive)", processes, count);
     
-    for (int i = 0; i < count; i++) {
-        result.processes[i] = processes[i];
-        reset_process(result.processes[i]);
-    }
+    // الخوارزمية تعمل على جدول أعمدة (SoA)، مع مؤشر حسب الوصول وطابور أولوية للجاهزة
+    ProcessTable table = process_table_from_array(result.processes, count);
+    int* order = arrival_order_create(table);
+    // الجداول الصغيرة تُختار منها العملية بمسح خطي على الأعمدة بدل الـ heap
+    MinHeap<ByBurstTime>* ready = count > READY_SCAN_THRESHOLD ? heap_create<ByBurstTime>(count) : nullptr;
     
     int current_time = 0;
     int completed = 0;
+    int next_arrival = 0;
+    ReadyWindow window = ready_window_create();
     
     while (completed < count) {
-        // البحث عن أقصر عملية وصلت
-        int shortest_idx = -1;
-        int shortest_burst = 999999;
-        
-        for (int i = 0; i < count; i++) {
-            if (!result.processes[i].is_completed &&
-                result.processes[i].arrival_time <= current_time &&
-                result.processes[i].burst_time < shortest_burst) {
-                shortest_burst = result.processes[i].burst_time;
-                shortest_idx = i;
+        // إضافة العمليات التي وصلت
+        while (next_arrival < count && table.arrival_time[order[next_arrival]] <= current_time) {
+            if (ready) {
+                heap_push(ready, table, order[next_arrival]);
+            } else {
+                ready_window_admit(window, order[next_arrival]);
             }
+            next_arrival++;
         }
         
-        // لا توجد عملية متاحة
-        if (shortest_idx == -1) {
-            current_time++;
+        // أقصر عملية جاهزة
+        int idx = ready ? heap_pop(ready) : ready_scan_argmin(table, table.burst_time, current_time, window);
+        
+        // لا توجد عملية متاحة: القفز مباشرة إلى الوصول التالي
+        if (idx == -1) {
+            current_time = table.arrival_time[order[next_arrival]];
             continue;
         }
         
-        Process& p = result.processes[shortest_idx];
-        p.start_time = current_time;
-        p.completion_time = current_time + p.burst_time;
-        p.turnaround_time = p.completion_time - p.arrival_time;
-        p.waiting_time = p.turnaround_time - p.burst_time;
-        p.is_completed = true;
+        table.start_time[idx] = current_time;
+        table.completion_time[idx] = current_time + table.burst_time[idx];
+        table.turnaround_time[idx] = table.completion_time[idx] - table.arrival_time[idx];
+        table.waiting_time[idx] = table.turnaround_time[idx] - table.burst_time[idx];
+        table.is_completed[idx] = 1;
         
-        result.timeline[result.timeline_length].process_id = p.id;
-        result.timeline[result.timeline_length].start_time = current_time;
-        result.timeline[result.timeline_length].end_time = p.completion_time;
-        result.timeline_length++;
+        push_execution_record(result, table.id[idx], current_time, table.completion_time[idx]);
         
-        current_time = p.completion_time;
+        current_time = table.completion_time[idx];
         completed++;
     }
     
+    process_table_to_array(table, result.processes);
+    process_table_destroy(table);
+    arrival_order_destroy(order);
+    heap_destroy(ready);
     return result;
 }
 
 // ==========================================
 // SJF Preemptive (SRTF)
 // ==========================================
+// محاكاة مبنية على الأحداث: الزمن يقفز مباشرة إلى وصول العملية التالية
+// أو انتهاء العملية الجارية، بدلاً من التقدم وحدة زمنية في كل مرة
 SchedulingResult sjf_preemptive(Process processes[], int count) {
-    SchedulingResult result;
-    strcpy(result.algorithm_name, "SJF Preemptive (SRTF)");
-    result.process_count = count;
-    result.timeline_length = 0;
+    SchedulingResult result = result_create("SJF Preemptive (SRTF)", processes, count);
     
-    for (int i = 0; i < count; i++) {
-        result.processes[i] = processes[i];
-        reset_process(result.processes[i]);
-    }
+    // مؤشر على العمليات حسب الوصول، والعمليات الجاهزة حسب الوقت المتبقي
+    ProcessTable table = process_table_from_array(result.processes, count);
+    int* order = arrival_order_create(table);
+    // كما في النسخة غير الاستباقية: مسح خطي للجداول الصغيرة
+    IndexedHeap<ByRemainingTime>* ready = count > READY_SCAN_THRESHOLD ? iheap_create<ByRemainingTime>(count) : nullptr;
     
     int current_time = 0;
     int completed = 0;
+    int next_arrival = 0;
+    ReadyWindow window = ready_window_create();
     
     while (completed < count) {
-        // البحث عن العملية ذات أقصر وقت متبقي
-        int shortest_idx = -1;
-        int shortest_remaining = 999999;
-        
-        for (int i = 0; i < count; i++) {
-            if (!result.processes[i].is_completed &&
-                result.processes[i].arrival_time <= current_time &&
-                result.processes[i].remaining_time < shortest_remaining) {
-                shortest_remaining = result.processes[i].remaining_time;
-                shortest_idx = i;
+        // نقل العمليات التي وصلت إلى الطابور الجاهز
+        while (next_arrival < count && table.arrival_time[order[next_arrival]] <= current_time) {
+            if (ready) {
+                iheap_push(ready, table, order[next_arrival]);
+            } else {
+                ready_window_admit(window, order[next_arrival]);
             }
+            next_arrival++;
         }
         
-        if (shortest_idx == -1) {
-            current_time++;
+        // العملية الجارية تبقى في الـ heap طوال تنفيذها
+        int idx = ready ? iheap_peek(ready) : ready_scan_argmin(table, table.remaining_time, current_time, window);
+        
+        // المعالج خامل: القفز مباشرة إلى الوصول التالي
+        if (idx == -1) {
+            current_time = table.arrival_time[order[next_arrival]];
             continue;
         }
         
-        Process& p = result.processes[shortest_idx];
-        if (p.start_time == -1) {
-            p.start_time = current_time;
+        if (table.start_time[idx] == -1) {
+            table.start_time[idx] = current_time;
+        }
+        
+        // التنفيذ حتى الانتهاء أو حتى وصول عملية جديدة قد تستبقها
+        int run_until = current_time + table.remaining_time[idx];
+        if (next_arrival < count && table.arrival_time[order[next_arrival]] < run_until) {
+            run_until = table.arrival_time[order[next_arrival]];
         }
         
-        // تسجيل كل وحدة زمنية كـ entry منفصلة
-        result.timeline[result.timeline_length].process_id = p.id;
-        result.timeline[result.timeline_length].start_time = current_time;
-        result.timeline[result.timeline_length].end_time = current_time + 1;
-        result.timeline_length++;
+        // دمج الشريحة مع السابقة إذا استمرت نفس العملية
+        append_execution_record(result, table.id[idx], current_time, run_until);
         
-        p.remaining_time--;
-        current_time++;
+        table.remaining_time[idx] -= run_until - current_time;
+        current_time = run_until;
         
-        if (p.remaining_time == 0) {
-            p.completion_time = current_time;
-            p.turnaround_time = p.completion_time - p.arrival_time;
-            p.waiting_time = p.turnaround_time - p.burst_time;
-            p.is_completed = true;
+        if (table.remaining_time[idx] == 0) {
+            table.completion_time[idx] = current_time;
+            table.turnaround_time[idx] = table.completion_time[idx] - table.arrival_time[idx];
+            table.waiting_time[idx] = table.turnaround_time[idx] - table.burst_time[idx];
+            table.is_completed[idx] = 1;
             completed++;
+            if (ready) iheap_pop(ready);
+        } else if (ready) {
+            // تحديث مفتاحها فقط بدلاً من إخراجها وإعادة إدخالها
+            iheap_decrease_key(ready, idx, table.remaining_time[idx]);
         }
     }
     
+    process_table_to_array(table, result.processes);
+    process_table_destroy(table);
+    arrival_order_destroy(order);
+    iheap_destroy(ready);
     return result;
 }
 
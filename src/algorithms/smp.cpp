@@ -0,0 +1,469 @@
+/**
+ * @file smp.cpp
+ * @brief محاكاة الجدولة على عدة معالجات (SMP)
+ *
+ * نفس السياسات الست على N معالج، بأحد نمطين:
+ * - طابور عام (global run queue): كل المعالجات تأخذ من مجموعة جاهزة واحدة
+ * - طوابير لكل معالج (per-CPU run queues): كل عملية تُسند عند وصولها
+ *   للمعالج الأقل حملاً، ثم يجدول كل معالج عملياته وحده بالخوارزمية العادية
+ *
+ * كل سجل في الجدول الزمني يحمل رقم المعالج (cpu_id)
+ * وعلى معالج واحد تعطي الطابور العام نفس نتائج الخوارزميات العادية
+ */
+
+#ifndef SMP_CPP_INCLUDED
+#define SMP_CPP_INCLUDED
+
+#include <climits>
+#include <cstdio>
+
+#include "fcfs.cpp"
+#include "sjf.cpp"
+#include "priority.cpp"
+#include "round_robin.cpp"
+
+using namespace std;
+
+// ==========================================
+// نمط الطوابير
+// ==========================================
+enum SmpQueueMode {
+    SMP_GLOBAL_QUEUE,       // طابور جاهز واحد مشترك
+    SMP_PER_CPU_QUEUES      // طابور مستقل لكل معالج
+};
+
+// ==========================================
+// حالة المعالجات
+// ==========================================
+struct SmpCpus {
+    int count;
+    int* running;           // فهرس العملية الجارية أو -1
+    int* slice_start;       // بداية الشريحة الحالية
+    int* slice_end;         // نهاية الشريحة المخططة
+    IndexedHeap<LexicographicOrder>* events;    // المعالجات المشغولة حسب نهاية الشريحة
+    IndexedHeap<LexicographicOrder>* idle;      // المعالجات الخاملة حسب الرقم
+};
+
+// إعادة المعالج لمجموعة الخاملة
+void smp_mark_idle(SmpCpus& cpus, int cpu) {
+    HeapEntry e = {cpu, 0, cpu};
+    iheap_push_entry(cpus.idle, e);
+}
+
+SmpCpus smp_cpus_create(int cpu_count) {
+    SmpCpus cpus;
+    cpus.count = cpu_count;
+    cpus.running = (int*)malloc(sizeof(int) * cpu_count * 3);
+    cpus.slice_start = cpus.running + cpu_count;
+    cpus.slice_end = cpus.running + 2 * cpu_count;
+    cpus.events = iheap_create<LexicographicOrder>(cpu_count);
+    cpus.idle = iheap_create<LexicographicOrder>(cpu_count);
+
+    for (int cpu = 0; cpu < cpu_count; cpu++) {
+        cpus.running[cpu] = -1;
+        smp_mark_idle(cpus, cpu);
+    }
+    return cpus;
+}
+
+void smp_cpus_destroy(SmpCpus& cpus) {
+    free(cpus.running);
+    iheap_destroy(cpus.events);
+    iheap_destroy(cpus.idle);
+    cpus.running = nullptr;
+}
+
+// تشغيل العملية idx على المعالج cpu في المجال [start, end)
+void smp_start_slice(SmpCpus& cpus, int cpu, int idx, int start, int end) {
+    cpus.running[cpu] = idx;
+    cpus.slice_start[cpu] = start;
+    cpus.slice_end[cpu] = end;
+    HeapEntry e = {end, 0, cpu};
+    iheap_push_entry(cpus.events, e);
+}
+
+// إيقاف المعالج (انتهاء الشريحة أو استباقها) وإعادته للخاملة
+void smp_stop_slice(SmpCpus& cpus, int cpu) {
+    iheap_erase(cpus.events, cpu);
+    cpus.running[cpu] = -1;
+    smp_mark_idle(cpus, cpu);
+}
+
+// أقرب نهاية شريحة، أو INT_MAX إذا كانت كل المعالجات خاملة
+int smp_next_event(const SmpCpus& cpus) {
+    int cpu = iheap_peek(cpus.events);
+    return (cpu == -1) ? INT_MAX : cpus.slice_end[cpu];
+}
+
+// المعالج الذي تنتهي شريحته عند now، أو -1
+int smp_pop_event_at(SmpCpus& cpus, int now) {
+    int cpu = iheap_peek(cpus.events);
+    if (cpu == -1 || cpus.slice_end[cpu] != now) return -1;
+    return cpu;
+}
+
+// تشغيل شريحة من العملية result.processes[idx] (حتى time_quantum) على cpu
+// يعيد true إذا اكتملت العملية بهذه الشريحة
+bool smp_run_slice(SchedulingResult& result, SmpCpus& cpus, int cpu, int idx, int now, int time_quantum) {
+    Process& current = result.processes[idx];
+    if (current.start_time == -1) {
+        current.start_time = now;
+    }
+    int exec_time = (current.remaining_time < time_quantum) ? current.remaining_time : time_quantum;
+    push_execution_record(result, current.id, now, now + exec_time, cpu);
+    smp_start_slice(cpus, cpu, idx, now, now + exec_time);
+    
+    current.remaining_time -= exec_time;
+    if (current.remaining_time > 0) return false;
+    
+    current.completion_time = now + exec_time;
+    current.turnaround_time = current.completion_time - current.arrival_time;
+    current.waiting_time = current.turnaround_time - current.burst_time;
+    current.is_completed = true;
+    return true;
+}
+
+// ==========================================
+// الطابور العام: FCFS و Round Robin
+// ==========================================
+// طابور FIFO واحد. FCFS هو Round Robin بشريحة غير محدودة
+// عند كل حدث: تنتهي الشرائح، ثم تدخل العمليات الواصلة، ثم تعود
+// العمليات التي انتهت شريحتها لآخر الطابور (نفس ترتيب round_robin)
+void smp_queue_dispatch(SchedulingResult& result, SmpCpus& cpus, int time_quantum) {
+    Process* p = result.processes;     // مرتبة حسب الوصول (smp_schedule)
+    int count = result.process_count;
+
+    IndexQueue* ready = index_queue_create();
+    int* expired = (int*)malloc(sizeof(int) * cpus.count);
+    int completed = 0;
+    int next_arrival = 0;
+
+    while (completed < count) {
+        int now = smp_next_event(cpus);
+        if (next_arrival < count && p[next_arrival].arrival_time < now) {
+            now = p[next_arrival].arrival_time;
+        }
+
+        // الشرائح المنتهية عند now (بترتيب رقم المعالج)
+        int expired_count = 0;
+        int cpu;
+        while ((cpu = smp_pop_event_at(cpus, now)) != -1) {
+            int idx = cpus.running[cpu];
+            smp_stop_slice(cpus, cpu);
+            if (!p[idx].is_completed) {
+                expired[expired_count++] = idx;
+            }
+        }
+
+        // العمليات الواصلة ثم العائدة
+        while (next_arrival < count && p[next_arrival].arrival_time <= now) {
+            index_queue_push(ready, next_arrival);
+            next_arrival++;
+        }
+        for (int k = 0; k < expired_count; k++) {
+            index_queue_push(ready, expired[k]);
+        }
+
+        // توزيع الطابور على المعالجات الخاملة
+        while (!iheap_is_empty(cpus.idle) && !index_queue_is_empty(ready)) {
+            int idx = index_queue_pop(ready);
+            cpu = iheap_pop(cpus.idle);
+            if (smp_run_slice(result, cpus, cpu, idx, now, time_quantum)) {
+                completed++;
+            }
+        }
+    }
+
+    free(expired);
+    index_queue_destroy(ready);
+}
+
+// ==========================================
+// الطابور العام: SJF و Priority (غير استباقية)
+// ==========================================
+// heap جاهز واحد، وكل معالج يتحرر يأخذ أفضل عملية فيه
+template <typename Order>
+void smp_heap_dispatch(SchedulingResult& result, SmpCpus& cpus) {
+    int count = result.process_count;
+    ProcessTable table = process_table_from_array(result.processes, count);
+    int* order = arrival_order_create(table);
+    MinHeap<Order>* ready = heap_create<Order>(count);
+
+    int completed = 0;
+    int next_arrival = 0;
+
+    while (completed < count) {
+        int now = smp_next_event(cpus);
+        if (next_arrival < count && table.arrival_time[order[next_arrival]] < now) {
+            now = table.arrival_time[order[next_arrival]];
+        }
+
+        int cpu;
+        while ((cpu = smp_pop_event_at(cpus, now)) != -1) {
+            smp_stop_slice(cpus, cpu);
+        }
+
+        while (next_arrival < count && table.arrival_time[order[next_arrival]] <= now) {
+            heap_push(ready, table, order[next_arrival]);
+            next_arrival++;
+        }
+
+        // العملية تعمل حتى النهاية على المعالج الذي أخذها
+        while (!iheap_is_empty(cpus.idle) && !heap_is_empty(ready)) {
+            int idx = heap_pop(ready);
+            cpu = iheap_pop(cpus.idle);
+
+            table.start_time[idx] = now;
+            table.completion_time[idx] = now + table.burst_time[idx];
+            table.turnaround_time[idx] = table.completion_time[idx] - table.arrival_time[idx];
+            table.waiting_time[idx] = table.turnaround_time[idx] - table.burst_time[idx];
+            table.is_completed[idx] = 1;
+            completed++;
+
+            push_execution_record(result, table.id[idx], now, table.completion_time[idx], cpu);
+            smp_start_slice(cpus, cpu, idx, now, table.completion_time[idx]);
+        }
+    }
+
+    process_table_to_array(table, result.processes);
+    process_table_destroy(table);
+    arrival_order_destroy(order);
+    heap_destroy(ready);
+}
+
+// ==========================================
+// الطابور العام: SRTF و Priority (استباقية)
+// ==========================================
+// تعمل دائماً أفضل N عملية متاحة. العمليات الجارية في heap ثانٍ
+// أسوأها في القمة، فتُستبق إذا ظهرت عملية جاهزة أفضل منها
+//
+// remaining_key: المفتاح هو الوقت المتبقي (SRTF). المتبقي لكل العمليات
+// الجارية ينقص بنفس المعدل، فنقارن بوقت الانتهاء (now + المتبقي)
+// ليبقى مفتاح العملية الجارية ثابتاً طوال تشغيلها
+inline int smp_finish_key(int remaining, int now) {
+    long long finish = (long long)remaining + now;
+    return (finish > INT_MAX) ? INT_MAX : (int)finish;
+}
+
+template <typename Order>
+void smp_preemptive_dispatch(SchedulingResult& result, SmpCpus& cpus, bool remaining_key) {
+    int count = result.process_count;
+    ProcessTable table = process_table_from_array(result.processes, count);
+    int* order = arrival_order_create(table);
+    IndexedHeap<Order>* ready = iheap_create<Order>(count);
+    IndexedHeap<LexicographicOrder>* victims = iheap_create<LexicographicOrder>(cpus.count);
+    HeapEntry* running_key = (HeapEntry*)malloc(sizeof(HeapEntry) * cpus.count);
+
+    int completed = 0;
+    int next_arrival = 0;
+
+    while (completed < count) {
+        int now = smp_next_event(cpus);
+        if (next_arrival < count && table.arrival_time[order[next_arrival]] < now) {
+            now = table.arrival_time[order[next_arrival]];
+        }
+
+        // العمليات المنتهية
+        int cpu;
+        while ((cpu = smp_pop_event_at(cpus, now)) != -1) {
+            int idx = cpus.running[cpu];
+            append_execution_record(result, table.id[idx], cpus.slice_start[cpu], now, cpu);
+
+            table.remaining_time[idx] = 0;
+            table.completion_time[idx] = now;
+            table.turnaround_time[idx] = table.completion_time[idx] - table.arrival_time[idx];
+            table.waiting_time[idx] = table.turnaround_time[idx] - table.burst_time[idx];
+            table.is_completed[idx] = 1;
+            completed++;
+
+            iheap_erase(victims, cpu);
+            smp_stop_slice(cpus, cpu);
+        }
+
+        while (next_arrival < count && table.arrival_time[order[next_arrival]] <= now) {
+            iheap_push(ready, table, order[next_arrival]);
+            next_arrival++;
+        }
+
+        while (!iheap_is_empty(ready)) {
+            if (iheap_is_empty(cpus.idle)) {
+                int victim_cpu = iheap_peek(victims);
+                // لا يوجد معالج خامل: الاستباق فقط إذا كانت الجاهزة أفضل من أسوأ جارية
+                HeapEntry candidate = Order::entry(table, iheap_peek(ready));
+                if (remaining_key) candidate.key = smp_finish_key(candidate.key, now);
+                if (!LexicographicOrder::less(candidate, running_key[victim_cpu])) break;
+
+                int victim = cpus.running[victim_cpu];
+                append_execution_record(result, table.id[victim], cpus.slice_start[victim_cpu], now, victim_cpu);
+                table.remaining_time[victim] -= now - cpus.slice_start[victim_cpu];
+                iheap_erase(victims, victim_cpu);
+                smp_stop_slice(cpus, victim_cpu);
+                iheap_push(ready, table, victim);
+            }
+
+            int idx = iheap_pop(ready);
+            cpu = iheap_pop(cpus.idle);
+            if (table.start_time[idx] == -1) {
+                table.start_time[idx] = now;
+            }
+
+            running_key[cpu] = Order::entry(table, idx);
+            if (remaining_key) running_key[cpu].key = smp_finish_key(running_key[cpu].key, now);
+            HeapEntry worst = {-running_key[cpu].key, -running_key[cpu].tie, cpu};
+            iheap_push_entry(victims, worst);
+            smp_start_slice(cpus, cpu, idx, now, now + table.remaining_time[idx]);
+        }
+    }
+
+    process_table_to_array(table, result.processes);
+    process_table_destroy(table);
+    arrival_order_destroy(order);
+    iheap_destroy(ready);
+    iheap_destroy(victims);
+    free(running_key);
+}
+
+// ==========================================
+// طوابير لكل معالج
+// ==========================================
+
+// الخوارزمية العادية (معالج واحد) حسب رقمها
+SchedulingResult smp_run_single(int algorithm_id, Process processes[], int count, int time_quantum) {
+    switch (algorithm_id) {
+        case 2: return sjf_non_preemptive(processes, count);
+        case 3: return sjf_preemptive(processes, count);
+        case 4: return priority_non_preemptive(processes, count);
+        case 5: return priority_preemptive(processes, count);
+        case 6: return round_robin(processes, count, time_quantum);
+        default: return fcfs(processes, count);
+    }
+}
+
+// كل عملية تُسند عند وصولها للمعالج الذي يتوقع أن يفرغ أولاً
+// (مجموع أوقات التنفيذ المسندة إليه)، ولا تنتقل بعد ذلك
+void smp_per_cpu_dispatch(SchedulingResult& result, int algorithm_id, int cpu_count, int time_quantum) {
+    int count = result.process_count;
+    int* order = arrival_order_create(result.processes, count);
+    int* assigned = (int*)malloc(sizeof(int) * (count > 0 ? count : 1));
+    int* offset = (int*)calloc(cpu_count + 1, sizeof(int));
+    int* projected = (int*)calloc(cpu_count, sizeof(int));
+    MinHeap<LexicographicOrder>* load = heap_create<LexicographicOrder>(cpu_count);
+
+    for (int cpu = 0; cpu < cpu_count; cpu++) {
+        HeapEntry e = {0, 0, cpu};
+        heap_push_entry(load, e);
+    }
+    for (int k = 0; k < count; k++) {
+        const Process& p = result.processes[order[k]];
+        int cpu = heap_pop(load);
+        int start = (projected[cpu] > p.arrival_time) ? projected[cpu] : p.arrival_time;
+        projected[cpu] = start + p.burst_time;
+        HeapEntry e = {projected[cpu], 0, cpu};
+        heap_push_entry(load, e);
+
+        assigned[order[k]] = cpu;
+        offset[cpu + 1]++;
+    }
+    for (int cpu = 0; cpu < cpu_count; cpu++) {
+        offset[cpu + 1] += offset[cpu];
+    }
+
+    // تجميع عمليات كل معالج متجاورة وبترتيب الوصول
+    Process* local = (Process*)malloc(sizeof(Process) * (count > 0 ? count : 1));
+    int* origin = (int*)malloc(sizeof(int) * (count > 0 ? count : 1));
+    int* fill = projected;
+    for (int cpu = 0; cpu < cpu_count; cpu++) {
+        fill[cpu] = offset[cpu];
+    }
+    for (int k = 0; k < count; k++) {
+        int pos = fill[assigned[order[k]]]++;
+        local[pos] = result.processes[order[k]];
+        origin[pos] = order[k];
+    }
+
+    // جدولة كل معالج وحده. الإدخال مرتب حسب الوصول فتحافظ كل
+    // الخوارزميات على ترتيب العمليات في النتيجة
+    for (int cpu = 0; cpu < cpu_count; cpu++) {
+        int n = offset[cpu + 1] - offset[cpu];
+        if (n == 0) continue;
+
+        SchedulingResult sub = smp_run_single(algorithm_id, local + offset[cpu], n, time_quantum);
+        for (int j = 0; j < n; j++) {
+            result.processes[origin[offset[cpu] + j]] = sub.processes[j];
+        }
+        for (int r = 0; r < sub.timeline_length; r++) {
+            const ExecutionRecord& record = sub.timeline[r];
+            push_execution_record(result, record.process_id, record.start_time, record.end_time, cpu);
+        }
+        result_destroy(sub);
+    }
+
+    arrival_order_destroy(order);
+    free(assigned);
+    free(offset);
+    free(projected);
+    free(local);
+    free(origin);
+    heap_destroy(load);
+}
+
+// ==========================================
+// الواجهة
+// ==========================================
+
+// اسم الخوارزمية كما في نسختها ذات المعالج الواحد
+const char* smp_algorithm_name(int algorithm_id) {
+    switch (algorithm_id) {
+        case 2: return "SJF (Non-Preemptive)";
+        case 3: return "SJF Preemptive (SRTF)";
+        case 4: return "Priority (Non-Preemptive)";
+        case 5: return "Priority (Preemptive)";
+        case 6: return "Round Robin";
+        default: return "FCFS (First Come First Serve)";
+    }
+}
+
+// نتيجة باسم "<الخوارزمية> - N CPUs (<النمط>)" لكل المحاكاة متعددة المعالجات.
+// مع عدد معالجات كبير قد يتجاوز الاسم 64 حرفاً، و result_create يقصه إلى حجم الحقل
+SchedulingResult smp_result_create(int algorithm_id, int cpu_count, const char* mode_label,
+                                   const Process processes[], int count) {
+    char name[128];
+    snprintf(name, sizeof(name), "%s - %d CPUs (%s)", smp_algorithm_name(algorithm_id), cpu_count, mode_label);
+    SchedulingResult result = result_create(name, processes, count);
+    result.cpu_count = cpu_count;
+    return result;
+}
+
+// algorithm_id: نفس أرقام api_run_algorithm (1-6)
+SchedulingResult smp_schedule(int algorithm_id, Process processes[], int count, int cpu_count,
+                              SmpQueueMode mode, int time_quantum = DEFAULT_TIME_QUANTUM) {
+    if (cpu_count < 1) cpu_count = 1;
+
+    SchedulingResult result = smp_result_create(algorithm_id, cpu_count,
+                                                (mode == SMP_PER_CPU_QUEUES) ? "per-CPU queues" : "global queue",
+                                                processes, count);
+
+    // FCFS و RR ترتبان العمليات حسب الوصول كنسختيهما العاديتين
+    if (algorithm_id == 1 || algorithm_id == 6) {
+        sort_processes_by_arrival(result.processes, count);
+    }
+
+    if (mode == SMP_PER_CPU_QUEUES) {
+        smp_per_cpu_dispatch(result, algorithm_id, cpu_count, time_quantum);
+        return result;
+    }
+
+    SmpCpus cpus = smp_cpus_create(cpu_count);
+    switch (algorithm_id) {
+        case 2: smp_heap_dispatch<ByBurstTime>(result, cpus); break;
+        case 3: smp_preemptive_dispatch<ByRemainingTime>(result, cpus, true); break;
+        case 4: smp_heap_dispatch<ByPriority>(result, cpus); break;
+        case 5: smp_preemptive_dispatch<ByPriority>(result, cpus, false); break;
+        case 6: smp_queue_dispatch(result, cpus, time_quantum); break;
+        default: smp_queue_dispatch(result, cpus, INT_MAX); break;
+    }
+    smp_cpus_destroy(cpus);
+    return result;
+}
+
+#endif // SMP_CPP_INCLUDED
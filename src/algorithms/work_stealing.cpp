@@ -0,0 +1,255 @@
+/**
+ * @file work_stealing.cpp
+ * @brief محاكاة سرقة العمل (Work Stealing) بين طوابير المعالجات
+ *
+ * لكل معالج طابور مزدوج (deque) من LinkedList:
+ * - العمليات الواصلة إلى المعالج والعائدة من شريحتها تُضاف في الخلف
+ *   والمعالج يأخذ من الأمام (FCFS أو Round Robin)
+ * - المعالج الخامل الذي فرغ طابوره يسرق عملية من خلف أطول طابور
+ *
+ * العمليات الواصلة توزع على المعالجات بالتناوب حسب ترتيب الوصول
+ * (دون معرفة بالحمل)، والسرقة هي التي توازن الحمل بعد ذلك
+ */
+
+#ifndef WORK_STEALING_CPP_INCLUDED
+#define WORK_STEALING_CPP_INCLUDED
+
+#include "../data_structures/linked_list.cpp"
+#include "smp.cpp"
+
+using namespace std;
+
+// ==========================================
+// الإحصائيات
+// ==========================================
+struct WorkStealingStats {
+    int steals;             // عدد العمليات المسروقة
+    int migrations;         // مرات استئناف عملية على معالج غير الذي عملت عليه آخر مرة
+};
+
+// مقارنة سرقة العمل بالطابور العام لنفس الخوارزمية
+struct WorkStealingReport {
+    int cpu_count;
+    int steals;
+    int migrations;
+    long long makespan;
+    int global_migrations;
+    long long global_makespan;
+    double makespan_improvement;    // % مقارنة بالطابور العام (موجب = أقصر)
+};
+
+// ==========================================
+// دوال مساعدة
+// ==========================================
+
+// المعالج صاحب أطول طابور (الأصغر رقماً عند التساوي)، أو -1 إذا فرغت كلها
+int ws_find_victim(LinkedList** deques, int cpu_count) {
+    int victim = -1;
+    int longest = 0;
+    for (int cpu = 0; cpu < cpu_count; cpu++) {
+        if (list_get_size(deques[cpu]) > longest) {
+            longest = list_get_size(deques[cpu]);
+            victim = cpu;
+        }
+    }
+    return victim;
+}
+
+// تشغيل شريحة على cpu مع عدّ الانتقال إذا عملت العملية آخر مرة على معالج آخر
+bool ws_run_slice(SchedulingResult& result, SmpCpus& cpus, int cpu, int idx, int now, int time_quantum,
+                  int* last_cpu, WorkStealingStats& counters) {
+    if (last_cpu[idx] != -1 && last_cpu[idx] != cpu) counters.migrations++;
+    last_cpu[idx] = cpu;
+    return smp_run_slice(result, cpus, cpu, idx, now, time_quantum);
+}
+
+// المدة من أول وصول إلى آخر انتهاء
+long long result_makespan(const SchedulingResult& result) {
+    if (result.process_count == 0) return 0;
+    int first_arrival = result.processes[0].arrival_time;
+    int last_completion = result.processes[0].completion_time;
+    for (int i = 1; i < result.process_count; i++) {
+        if (result.processes[i].arrival_time < first_arrival) first_arrival = result.processes[i].arrival_time;
+        if (result.processes[i].completion_time > last_completion) last_completion = result.processes[i].completion_time;
+    }
+    return (long long)last_completion - first_arrival;
+}
+
+// ترتيب أرقام المعالجات
+int ws_compare_ints(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x < y) ? -1 : (x > y);
+}
+
+// ترتيب أزواج (المعرف، الفهرس) للبحث الثنائي
+int ws_compare_pairs(const void* a, const void* b) {
+    const int* x = (const int*)a;
+    const int* y = (const int*)b;
+    if (x[0] != y[0]) return (x[0] < y[0]) ? -1 : 1;
+    return (x[1] < y[1]) ? -1 : (x[1] > y[1]);
+}
+
+// عدد الانتقالات بين المعالجات من الجدول الزمني لأي نتيجة
+// (سجلات كل عملية يجب أن تكون بترتيب زمني، كما في smp_schedule)
+int count_migrations(const SchedulingResult& result) {
+    int count = result.process_count;
+    if (count == 0 || result.cpu_count <= 1) return 0;
+
+    // خريطة المعرف -> الفهرس بالترتيب والبحث الثنائي
+    int* pairs = (int*)malloc(sizeof(int) * 2 * (size_t)count);
+    for (int i = 0; i < count; i++) {
+        pairs[2 * i] = result.processes[i].id;
+        pairs[2 * i + 1] = i;
+    }
+    qsort(pairs, count, sizeof(int) * 2, ws_compare_pairs);
+
+    int* last_cpu = (int*)malloc(sizeof(int) * (size_t)count);
+    for (int i = 0; i < count; i++) last_cpu[i] = -1;
+
+    int migrations = 0;
+    for (int r = 0; r < result.timeline_length; r++) {
+        const ExecutionRecord& record = result.timeline[r];
+        int lo = 0, hi = count - 1;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (pairs[2 * mid] < record.process_id) lo = mid + 1; else hi = mid;
+        }
+        int slot = pairs[2 * lo + 1];
+        if (last_cpu[slot] != -1 && last_cpu[slot] != record.cpu_id) migrations++;
+        last_cpu[slot] = record.cpu_id;
+    }
+
+    free(pairs);
+    free(last_cpu);
+    return migrations;
+}
+
+// ==========================================
+// Work Stealing
+// ==========================================
+// algorithm_id: 1 (FCFS) أو 6 (Round Robin)
+SchedulingResult work_stealing(int algorithm_id, Process processes[], int count, int cpu_count,
+                               int time_quantum = DEFAULT_TIME_QUANTUM, WorkStealingStats* stats = nullptr) {
+    if (cpu_count < 1) cpu_count = 1;
+    if (algorithm_id != 6) {
+        algorithm_id = 1;
+        time_quantum = INT_MAX;
+    }
+
+    SchedulingResult result = smp_result_create(algorithm_id, cpu_count, "work stealing", processes, count);
+    sort_processes_by_arrival(result.processes, count);
+    Process* p = result.processes;
+
+    // كل الطوابير تأخذ عقدها من Arena واحدة
+    NodeArena* arena = arena_create();
+    LinkedList** deques = (LinkedList**)malloc(sizeof(LinkedList*) * cpu_count);
+    for (int cpu = 0; cpu < cpu_count; cpu++) {
+        deques[cpu] = list_create_in(arena);
+    }
+
+    SmpCpus cpus = smp_cpus_create(cpu_count);
+    int* last_cpu = (int*)malloc(sizeof(int) * (count > 0 ? count : 1));
+    int* expired = (int*)malloc(sizeof(int) * cpu_count);
+    int* woken = (int*)malloc(sizeof(int) * 2 * cpu_count);
+    for (int i = 0; i < count; i++) last_cpu[i] = -1;
+
+    WorkStealingStats counters = {0, 0};
+    int completed = 0;
+    int next_arrival = 0;
+    int queued = 0;         // مجموع أطوال الطوابير
+
+    while (completed < count) {
+        int now = smp_next_event(cpus);
+        if (next_arrival < count && p[next_arrival].arrival_time < now) {
+            now = p[next_arrival].arrival_time;
+        }
+
+        // الشرائح المنتهية عند now
+        // المعالج المتحرر مرشح لأخذ ما في طابوره
+        int expired_count = 0;
+        int woken_count = 0;
+        int cpu;
+        while ((cpu = smp_pop_event_at(cpus, now)) != -1) {
+            int idx = cpus.running[cpu];
+            smp_stop_slice(cpus, cpu);
+            woken[woken_count++] = cpu;
+            if (!p[idx].is_completed) {
+                expired[expired_count++] = idx;
+            }
+        }
+
+        // الواصلة بالتناوب، ثم العائدة إلى طابور المعالج الذي عملت عليه
+        // المعالج الخامل الذي صار طابوره غير فارغ مرشح أيضاً
+        while (next_arrival < count && p[next_arrival].arrival_time <= now) {
+            cpu = next_arrival % cpu_count;
+            list_insert_back_tagged(deques[cpu], p[next_arrival], next_arrival);
+            if (list_get_size(deques[cpu]) == 1 && iheap_contains(cpus.idle, cpu)) {
+                woken[woken_count++] = cpu;
+            }
+            next_arrival++;
+            queued++;
+        }
+        for (int k = 0; k < expired_count; k++) {
+            list_insert_back_tagged(deques[last_cpu[expired[k]]], p[expired[k]], expired[k]);
+            queued++;
+        }
+
+        // كل معالج خامل يأخذ أولاً من طابوره، بترتيب الرقم كما في smp_schedule...
+        // (بقية الخاملة طوابيرها فارغة فلا داعي لفحصها)
+        qsort(woken, woken_count, sizeof(int), ws_compare_ints);
+        for (int k = 0; k < woken_count; k++) {
+            cpu = woken[k];
+            if (list_is_empty(deques[cpu]) || !iheap_contains(cpus.idle, cpu)) continue;
+            int idx;
+            list_remove_front_tagged(deques[cpu], &idx);
+            queued--;
+            iheap_erase(cpus.idle, cpu);
+            if (ws_run_slice(result, cpus, cpu, idx, now, time_quantum, last_cpu, counters)) completed++;
+        }
+
+        // ...ثم يسرق الخاملون بترتيب الرقم من خلف أطول طابور
+        while (queued > 0 && !iheap_is_empty(cpus.idle)) {
+            cpu = iheap_pop(cpus.idle);
+            int victim = ws_find_victim(deques, cpu_count);
+            int idx;
+            list_remove_back_tagged(deques[victim], &idx);
+            queued--;
+            counters.steals++;
+            if (ws_run_slice(result, cpus, cpu, idx, now, time_quantum, last_cpu, counters)) completed++;
+        }
+    }
+
+    for (int cpu = 0; cpu < cpu_count; cpu++) {
+        list_destroy(deques[cpu]);
+    }
+    free(deques);
+    arena_destroy(arena);
+    smp_cpus_destroy(cpus);
+    free(last_cpu);
+    free(expired);
+    free(woken);
+
+    if (stats) *stats = counters;
+    return result;
+}
+
+// ==========================================
+// المقارنة بالطابور العام
+// ==========================================
+WorkStealingReport work_stealing_report(const SchedulingResult& stolen, const WorkStealingStats& stats,
+                                        const SchedulingResult& global) {
+    WorkStealingReport report;
+    report.cpu_count = stolen.cpu_count;
+    report.steals = stats.steals;
+    report.migrations = stats.migrations;
+    report.makespan = result_makespan(stolen);
+    report.global_migrations = count_migrations(global);
+    report.global_makespan = result_makespan(global);
+    report.makespan_improvement = (report.global_makespan > 0)
+        ? (double)(report.global_makespan - report.makespan) / report.global_makespan * 100.0
+        : 0;
+    return report;
+}
+
+#endif // WORK_STEALING_CPP_INCLUDED
@@ -3,157 +3,495 @@
  * @brief واجهة برمجية للتكامل مع Python/GUI
  * 
  * يوفر واجهة بسيطة لاستدعاء الخوارزميات من خارج C++
+ * 
+ * كل الحالة في جلسة (SchedulerSession): العمليات وآخر نتيجة.
+ * دوال session_* لا تلمس أي متغير عام، فيمكن تشغيل جلسات مختلفة
+ * على threads مختلفة في نفس الوقت (الجلسة الواحدة لا تُشارك بين threads).
+ * دوال api_* هي نفس الواجهة على جلسة افتراضية واحدة (api_session)
  */
 
 #ifndef API_CPP_INCLUDED
 #define API_CPP_INCLUDED
 
 #include "io_handler.cpp"
+#include "json_writer.cpp"
+#include "result_cache.cpp"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 using namespace std;
 
-// ==========================================
-// متغيرات عامة للAPI
-// ==========================================
-Process api_processes[MAX_PROCESSES];
-int api_process_count = 0;
-SchedulingResult api_last_result;
+const int API_ALGORITHM_COUNT = 6;
 
 // ==========================================
-// إعادة تهيئة
+// الجلسة
 // ==========================================
-void api_reset() {
-    api_process_count = 0;
-    for (int i = 0; i < MAX_PROCESSES; i++) {
-        api_processes[i] = Process();
+struct SchedulerSession {
+    Process* processes;
+    int process_count;
+    int process_capacity;
+    SchedulingResult result;        // آخر نتيجة
+    
+    // وضع تدريجي (معالج واحد): كل خوارزمية تستأنف من آخر نقطة قبل
+    // أول تغيير في الحمل بدلاً من إعادة المحاكاة من الزمن 0
+    bool incremental;
+    IncrementalRun* runs[API_ALGORITHM_COUNT];
+};
+
+// جلسة جديدة فارغة (تُحرر بـ session_destroy)
+SchedulerSession* session_create() {
+    return (SchedulerSession*)calloc(1, sizeof(SchedulerSession));
+}
+
+// حذف كل العمليات (آخر نتيجة تبقى حتى التشغيل التالي)
+void session_reset(SchedulerSession* session) {
+    free(session->processes);
+    session->processes = nullptr;
+    session->process_count = 0;
+    session->process_capacity = 0;
+}
+
+// تفعيل الوضع التدريجي أو إيقافه (الإيقاف يحرر نقاط الاستئناف)
+void session_set_incremental(SchedulerSession* session, bool enabled) {
+    session->incremental = enabled;
+    if (enabled) return;
+    for (int a = 0; a < API_ALGORITHM_COUNT; a++) {
+        incremental_destroy(session->runs[a]);
+        session->runs[a] = nullptr;
     }
 }
 
+void session_destroy(SchedulerSession* session) {
+    if (!session) return;
+    session_set_incremental(session, false);
+    session_reset(session);
+    result_destroy(session->result);
+    free(session);
+}
+
 // ==========================================
 // إضافة عملية
 // ==========================================
-bool api_add_process(int id, int arrival, int burst, int priority) {
-    if (api_process_count >= MAX_PROCESSES) {
-        return false;
+bool session_add_process(SchedulerSession* session, int id, int arrival, int burst, int priority) {
+    // توسيع المصفوفة عند امتلائها
+    if (session->process_count >= session->process_capacity) {
+        int capacity = (session->process_capacity > 0) ? session->process_capacity * 2 : 64;
+        Process* grown = (Process*)realloc(session->processes, sizeof(Process) * capacity);
+        if (!grown) {
+            return false;
+        }
+        session->processes = grown;
+        session->process_capacity = capacity;
     }
-    api_processes[api_process_count] = create_process(id, arrival, burst, priority);
-    api_process_count++;
+    session->processes[session->process_count] = create_process(id, arrival, burst, priority);
+    session->process_count++;
     return true;
 }
 
 // ==========================================
 // تحميل من ملف
 // ==========================================
-bool api_load_from_file(const char* filename) {
-    api_reset();
-    int count = load_processes_from_file(filename, api_processes);
+bool session_load_from_file(SchedulerSession* session, const char* filename) {
+    session_reset(session);
+    int count;
+    Process* loaded = load_processes_from_file(filename, &count);
     if (count > 0) {
-        api_process_count = count;
+        session->processes = loaded;
+        session->process_count = count;
+        session->process_capacity = count;
         return true;
     }
+    free(loaded);
     return false;
 }
 
+// ==========================================
+// حساب نتيجة خوارزمية على مصفوفة عمليات
+// ==========================================
+// تعيد false إذا كان رقم الخوارزمية غير صحيح
+bool run_algorithm_on(SchedulingResult& result, int algorithm_id, Process processes[], int count,
+                      int time_quantum, int cpu_count, SmpQueueMode queue_mode) {
+    if (algorithm_id < 1 || algorithm_id > 6) {
+        return false;
+    }
+    
+    // cpu_count > 1: محاكاة عدة معالجات بنمط queue_mode
+    if (cpu_count > 1) {
+        result = smp_schedule(algorithm_id, processes, count, cpu_count, queue_mode, time_quantum);
+    } else {
+        result = smp_run_single(algorithm_id, processes, count, time_quantum);
+    }
+    calculate_statistics(result);
+    return true;
+}
+
+// نفس run_algorithm_on، مع إعادة النتيجة المحفوظة إذا سبق حساب نفس
+// الحمل بنفس الإعدادات (result_cache.cpp)
+bool run_algorithm_cached(SchedulingResult& result, int algorithm_id, Process processes[], int count,
+                          int time_quantum, int cpu_count, SmpQueueMode queue_mode) {
+    if (algorithm_id < 1 || algorithm_id > 6) {
+        return false;
+    }
+    ResultCacheKey key = result_cache_key(processes, count, algorithm_id, time_quantum, cpu_count, queue_mode);
+    if (result_cache_lookup(key, result)) {
+        return true;
+    }
+    run_algorithm_on(result, algorithm_id, processes, count, time_quantum, cpu_count, queue_mode);
+    result_cache_insert(key, result);
+    return true;
+}
+
+// نفس run_algorithm_cached على عمليات الجلسة، مع الاستئناف في الوضع التدريجي
+// (لكل خوارزمية نقاطها، فيمكن تشغيل خوارزميات مختلفة على threads مختلفة)
+bool session_run_on(SchedulerSession* session, SchedulingResult& result, int algorithm_id,
+                    int time_quantum, int cpu_count, SmpQueueMode queue_mode) {
+    if (!session->incremental || cpu_count > 1 || algorithm_id < 1 || algorithm_id > 6) {
+        return run_algorithm_cached(result, algorithm_id, session->processes, session->process_count,
+                                    time_quantum, cpu_count, queue_mode);
+    }
+    
+    ResultCacheKey key = result_cache_key(session->processes, session->process_count, algorithm_id,
+                                          time_quantum, cpu_count, queue_mode);
+    if (result_cache_lookup(key, result)) {
+        return true;
+    }
+    
+    // الـ quantum يغير نتيجة Round Robin فقط
+    IncrementalRun*& run = session->runs[algorithm_id - 1];
+    if (run && algorithm_id == 6 && run->time_quantum != time_quantum) {
+        incremental_destroy(run);
+        run = nullptr;
+    }
+    if (!run) {
+        run = incremental_create(algorithm_id, time_quantum);
+    }
+    result = incremental_run(run, session->processes, session->process_count);
+    calculate_statistics(result);
+    result_cache_insert(key, result);
+    return true;
+}
+
 // ==========================================
 // تشغيل خوارزمية
 // ==========================================
-SchedulingResult* api_run_algorithm(int algorithm_id, int time_quantum = DEFAULT_TIME_QUANTUM) {
-    if (api_process_count == 0) {
+// النتيجة في session->result وتبقى صالحة حتى التشغيل التالي للجلسة
+const SchedulingResult* session_run(SchedulerSession* session, int algorithm_id,
+                                    int time_quantum = DEFAULT_TIME_QUANTUM, int cpu_count = 1,
+                                    SmpQueueMode queue_mode = SMP_GLOBAL_QUEUE) {
+    if (session->process_count == 0) {
         return nullptr;
     }
     
-    switch (algorithm_id) {
-        case 1:
-            api_last_result = fcfs(api_processes, api_process_count);
-            break;
-        case 2:
-            api_last_result = sjf_non_preemptive(api_processes, api_process_count);
-            break;
-        case 3:
-            api_last_result = sjf_preemptive(api_processes, api_process_count);
-            break;
-        case 4:
-            api_last_result = priority_non_preemptive(api_processes, api_process_count);
-            break;
-        case 5:
-            api_last_result = priority_preemptive(api_processes, api_process_count);
-            break;
-        case 6:
-            api_last_result = round_robin(api_processes, api_process_count, time_quantum);
-            break;
-        default:
-            return nullptr;
+    // تحرير النتيجة السابقة قبل استبدالها
+    result_destroy(session->result);
+    
+    if (!session_run_on(session, session->result, algorithm_id, time_quantum, cpu_count, queue_mode)) {
+        return nullptr;
+    }
+    return &session->result;
+}
+
+const SchedulingResult* session_get_result(const SchedulerSession* session) {
+    return &session->result;
+}
+
+// ==========================================
+// تشغيل كل الخوارزميات بالتوازي
+// ==========================================
+
+// مجموعة threads ثابتة مشتركة بين كل الاستدعاءات (تُنشأ عند أول استخدام):
+// عددها hardware_concurrency - 1 مهما تعددت الطلبات المتزامنة (مثل
+// اتصالات --serve)، والـ thread المستدعي يعمل دائماً مع المجموعة
+struct ParallelJob {
+    function<void(int)> task;
+    int task_count;
+    int next_task;              // المهمة التالية التي لم تؤخذ (تحت القفل)
+    int finished;
+    ParallelJob* next_job;
+};
+
+struct ParallelPool {
+    mutex lock;
+    condition_variable work_ready;
+    condition_variable job_done;
+    ParallelJob* jobs = nullptr;    // المهام التي بقي فيها ما لم يؤخذ
+};
+
+// يأخذ المهمة التالية من أول job، أو -1 إذا لم يبق شيء (يُستدعى مع القفل)
+// الـ job يُزال من القائمة عند أخذ آخر مهمة فيه
+int parallel_claim(ParallelPool& pool, ParallelJob* job) {
+    if (job->next_task >= job->task_count) return -1;
+    int t = job->next_task++;
+    if (job->next_task == job->task_count) {
+        ParallelJob** link = &pool.jobs;
+        while (*link != job) link = &(*link)->next_job;
+        *link = job->next_job;
+    }
+    return t;
+}
+
+// تنفيذ مهمة ثم تسجيل انتهائها (يُستدعى مع القفل، ويعيده مقفلاً)
+void parallel_run(ParallelPool& pool, ParallelJob* job, int t, unique_lock<mutex>& guard) {
+    guard.unlock();
+    job->task(t);
+    guard.lock();
+    if (++job->finished == job->task_count) {
+        pool.job_done.notify_all();
+    }
+}
+
+void parallel_worker(ParallelPool* pool) {
+    unique_lock<mutex> guard(pool->lock);
+    while (true) {
+        pool->work_ready.wait(guard, [pool]() { return pool->jobs != nullptr; });
+        ParallelJob* job = pool->jobs;
+        parallel_run(*pool, job, parallel_claim(*pool, job), guard);
+    }
+}
+
+// المجموعة لا تُحرر أبداً: threads المجموعة تبقى حتى نهاية البرنامج
+ParallelPool& parallel_pool() {
+    static ParallelPool* pool = []() {
+        ParallelPool* created = new ParallelPool();
+        int workers = (int)thread::hardware_concurrency() - 1;
+        for (int w = 0; w < workers; w++) {
+            thread(parallel_worker, created).detach();
+        }
+        return created;
+    }();
+    return *pool;
+}
+
+// تنفيذ task(0) ... task(task_count - 1) على مجموعة الـ threads
+// كل thread يأخذ المهمة التالية حتى تنتهي المهام
+template <typename Task>
+void parallel_for(int task_count, Task task) {
+    if (task_count <= 0) return;
+    ParallelPool& pool = parallel_pool();
+    ParallelJob job;
+    job.task = task;
+    job.task_count = task_count;
+    job.next_task = 0;
+    job.finished = 0;
+    
+    unique_lock<mutex> guard(pool.lock);
+    job.next_job = pool.jobs;
+    pool.jobs = &job;
+    pool.work_ready.notify_all();
+    
+    int t;
+    while ((t = parallel_claim(pool, &job)) != -1) {
+        parallel_run(pool, &job, t, guard);
+    }
+    pool.job_done.wait(guard, [&job]() { return job.finished == job.task_count; });
+}
+
+// results[a - 1] نتيجة الخوارزمية a، لكل واحدة نتيجتها المستقلة
+// ويحررها المستدعي بـ result_destroy. session->result لا يتغير
+// بدون عمليات تبقى النتائج فارغة
+bool session_run_all_parallel(SchedulerSession* session, SchedulingResult results[],
+                              int time_quantum = DEFAULT_TIME_QUANTUM, int cpu_count = 1,
+                              SmpQueueMode queue_mode = SMP_GLOBAL_QUEUE) {
+    memset(results, 0, sizeof(SchedulingResult) * API_ALGORITHM_COUNT);
+    if (session->process_count == 0) {
+        return false;
+    }
+    
+    parallel_for(API_ALGORITHM_COUNT, [&](int t) {
+        session_run_on(session, results[t], t + 1, time_quantum, cpu_count, queue_mode);
+    });
+    return true;
+}
+
+// ==========================================
+// تشغيل سرقة العمل (FCFS أو Round Robin)
+// ==========================================
+// النتيجة في session->result، والمقارنة بالطابور العام في report
+const SchedulingResult* session_run_work_stealing(SchedulerSession* session, int algorithm_id,
+                                                  int time_quantum, int cpu_count,
+                                                  WorkStealingReport* report) {
+    if (session->process_count == 0 || (algorithm_id != 1 && algorithm_id != 6)) {
+        return nullptr;
     }
     
-    calculate_statistics(api_last_result);
-    return &api_last_result;
+    result_destroy(session->result);
+    WorkStealingStats stats;
+    session->result = work_stealing(algorithm_id, session->processes, session->process_count,
+                                    cpu_count, time_quantum, &stats);
+    calculate_statistics(session->result);
+    
+    if (report) {
+        SchedulingResult global = smp_schedule(algorithm_id, session->processes, session->process_count,
+                                               cpu_count, SMP_GLOBAL_QUEUE, time_quantum);
+        *report = work_stealing_report(session->result, stats, global);
+        result_destroy(global);
+    }
+    return &session->result;
 }
 
 // ==========================================
 // الحصول على النتيجة كـ JSON
 // ==========================================
+// كتابة متدفقة إلى writer (السجلات لا تُجمع في الذاكرة)
+void write_result_json(JsonWriter& w, const SchedulingResult& result) {
+    json_literal(w, "{"); json_newline(w);
+    json_literal(w, "  \"algorithm\": \""); json_text(w, result.algorithm_name);
+    json_literal(w, "\","); json_newline(w);
+    json_literal(w, "  \"avg_waiting_time\": "); json_double(w, result.avg_waiting_time);
+    json_literal(w, ","); json_newline(w);
+    json_literal(w, "  \"avg_turnaround_time\": "); json_double(w, result.avg_turnaround_time);
+    json_literal(w, ","); json_newline(w);
+    json_literal(w, "  \"cpu_utilization\": "); json_double(w, result.cpu_utilization);
+    json_literal(w, ","); json_newline(w);
+    
+    // حقول المعالجات المتعددة فقط عند الحاجة (المخرجات لمعالج واحد كما هي)
+    bool multi_cpu = result.cpu_count > 1 && result.cpu_utilizations;
+    if (multi_cpu) {
+        json_literal(w, "  \"cpu_count\": "); json_int(w, result.cpu_count);
+        json_literal(w, ","); json_newline(w);
+        json_literal(w, "  \"load_imbalance\": "); json_double(w, result.load_imbalance);
+        json_literal(w, ","); json_newline(w);
+        json_literal(w, "  \"cpu_utilizations\": [");
+        for (int cpu = 0; cpu < result.cpu_count; cpu++) {
+            if (cpu > 0) json_literal(w, ", ");
+            json_double(w, result.cpu_utilizations[cpu]);
+        }
+        json_literal(w, "],"); json_newline(w);
+    }
+    
+    json_literal(w, "  \"processes\": ["); json_newline(w);
+    for (int i = 0; i < result.process_count; i++) {
+        const Process& p = result.processes[i];
+        json_literal(w, "    {\"id\": "); json_int(w, p.id);
+        json_literal(w, ", \"arrival\": "); json_int(w, p.arrival_time);
+        json_literal(w, ", \"burst\": "); json_int(w, p.burst_time);
+        json_literal(w, ", \"priority\": "); json_int(w, p.priority);
+        json_literal(w, ", \"start\": "); json_int(w, p.start_time);
+        json_literal(w, ", \"completion\": "); json_int(w, p.completion_time);
+        json_literal(w, ", \"waiting\": "); json_int(w, p.waiting_time);
+        json_literal(w, ", \"turnaround\": "); json_int(w, p.turnaround_time);
+        json_literal(w, "}");
+        if (i < result.process_count - 1) json_literal(w, ",");
+        json_newline(w);
+    }
+    json_literal(w, "  ],"); json_newline(w);
+    
+    json_literal(w, "  \"timeline\": ["); json_newline(w);
+    for (int i = 0; i < result.timeline_length; i++) {
+        const ExecutionRecord& record = result.timeline[i];
+        json_literal(w, "    {\"process_id\": "); json_int(w, record.process_id);
+        json_literal(w, ", \"start\": "); json_int(w, record.start_time);
+        json_literal(w, ", \"end\": "); json_int(w, record.end_time);
+        if (multi_cpu) {
+            json_literal(w, ", \"cpu\": "); json_int(w, record.cpu_id);
+        }
+        json_literal(w, "}");
+        if (i < result.timeline_length - 1) json_literal(w, ",");
+        json_newline(w);
+    }
+    json_literal(w, "  ]"); json_newline(w);
+    
+    json_literal(w, "}"); json_newline(w);
+}
+
+// نفس المستند كنص (للنتائج الصغيرة وواجهات string)
+string result_to_json(const SchedulingResult& result) {
+    string json;
+    JsonWriter writer = json_writer_to_string(&json);
+    write_result_json(writer, result);
+    json_writer_destroy(writer);
+    return json;
+}
+
+void session_write_result_json(const SchedulerSession* session, JsonWriter& writer) {
+    write_result_json(writer, session->result);
+}
+
+string session_get_result_json(const SchedulerSession* session) {
+    return result_to_json(session->result);
+}
+
+// ==========================================
+// الجلسة الافتراضية (واجهة الـ CLI)
+// ==========================================
+SchedulerSession api_session = {};
+
+void api_reset() {
+    session_reset(&api_session);
+}
+
+bool api_add_process(int id, int arrival, int burst, int priority) {
+    return session_add_process(&api_session, id, arrival, burst, priority);
+}
+
+bool api_load_from_file(const char* filename) {
+    return session_load_from_file(&api_session, filename);
+}
+
+const SchedulingResult* api_run_algorithm(int algorithm_id, int time_quantum = DEFAULT_TIME_QUANTUM,
+                                          int cpu_count = 1, SmpQueueMode queue_mode = SMP_GLOBAL_QUEUE) {
+    return session_run(&api_session, algorithm_id, time_quantum, cpu_count, queue_mode);
+}
+
+bool api_run_all_parallel(SchedulingResult results[], int time_quantum = DEFAULT_TIME_QUANTUM,
+                          int cpu_count = 1, SmpQueueMode queue_mode = SMP_GLOBAL_QUEUE) {
+    return session_run_all_parallel(&api_session, results, time_quantum, cpu_count, queue_mode);
+}
+
+const SchedulingResult* api_run_work_stealing(int algorithm_id, int time_quantum, int cpu_count,
+                                              WorkStealingReport* report) {
+    return session_run_work_stealing(&api_session, algorithm_id, time_quantum, cpu_count, report);
+}
+
+// عدادات الـ cache المشترك بين كل الجلسات
+// (الحد والمسح: result_cache_set_limit و result_cache_clear)
+ResultCacheStats api_get_cache_stats() {
+    return result_cache_get_stats();
+}
+
 string api_get_result_json() {
-    stringstream json;
-    json << "{" << endl;
-    json << "  \"algorithm\": \"" << api_last_result.algorithm_name << "\"," << endl;
-    json << "  \"avg_waiting_time\": " << api_last_result.avg_waiting_time << "," << endl;
-    json << "  \"avg_turnaround_time\": " << api_last_result.avg_turnaround_time << "," << endl;
-    json << "  \"cpu_utilization\": " << api_last_result.cpu_utilization << "," << endl;
-    
-    json << "  \"processes\": [" << endl;
-    for (int i = 0; i < api_last_result.process_count; i++) {
-        const Process& p = api_last_result.processes[i];
-        json << "    {";
-        json << "\"id\": " << p.id << ", ";
-        json << "\"arrival\": " << p.arrival_time << ", ";
-        json << "\"burst\": " << p.burst_time << ", ";
-        json << "\"priority\": " << p.priority << ", ";
-        json << "\"start\": " << p.start_time << ", ";
-        json << "\"completion\": " << p.completion_time << ", ";
-        json << "\"waiting\": " << p.waiting_time << ", ";
-        json << "\"turnaround\": " << p.turnaround_time;
-        json << "}";
-        if (i < api_last_result.process_count - 1) json << ",";
-        json << endl;
-    }
-    json << "  ]," << endl;
-    
-    json << "  \"timeline\": [" << endl;
-    for (int i = 0; i < api_last_result.timeline_length; i++) {
-        json << "    {";
-        json << "\"process_id\": " << api_last_result.timeline[i].process_id << ", ";
-        json << "\"start\": " << api_last_result.timeline[i].start_time << ", ";
-        json << "\"end\": " << api_last_result.timeline[i].end_time;
-        json << "}";
-        if (i < api_last_result.timeline_length - 1) json << ",";
-        json << endl;
-    }
-    json << "  ]" << endl;
-    
-    json << "}" << endl;
-    
-    return json.str();
+    return session_get_result_json(&api_session);
+}
+
+void api_write_result_json(JsonWriter& writer) {
+    session_write_result_json(&api_session, writer);
 }
 
 // ==========================================
 // طباعة النتيجة
 // ==========================================
 void api_print_result() {
-    print_result(api_last_result);
-    print_gantt_chart(api_last_result);
+    print_result(api_session.result);
+    print_gantt_chart(api_session.result);
 }
 
 // ==========================================
 // Run All Algorithms
 // ==========================================
-void api_run_all_algorithms(int time_quantum = DEFAULT_TIME_QUANTUM) {
+void api_run_all_algorithms(int time_quantum = DEFAULT_TIME_QUANTUM,
+                            int cpu_count = 1, SmpQueueMode queue_mode = SMP_GLOBAL_QUEUE) {
     cout << "\n====== Running All Algorithms ======\n" << endl;
     
-    for (int algo = 1; algo <= 6; algo++) {
-        api_run_algorithm(algo, time_quantum);
-        api_print_result();
+    // الحساب بالتوازي ثم الطباعة بالترتيب
+    SchedulingResult results[API_ALGORITHM_COUNT];
+    if (!api_run_all_parallel(results, time_quantum, cpu_count, queue_mode)) {
+        return;
+    }
+    
+    for (int t = 0; t < API_ALGORITHM_COUNT; t++) {
+        print_result(results[t]);
+        print_gantt_chart(results[t]);
         cout << "\n" << string(50, '=') << "\n" << endl;
     }
+    
+    // آخر نتيجة تبقى في الجلسة كما في التشغيل المتتابع
+    result_destroy(api_session.result);
+    api_session.result = results[API_ALGORITHM_COUNT - 1];
+    for (int t = 0; t < API_ALGORITHM_COUNT - 1; t++) {
+        result_destroy(results[t]);
+    }
 }
 
 #endif // API_CPP_INCLUDED
@@ -0,0 +1,178 @@
+/**
+ * @file c_api.cpp
+ * @brief واجهة C للمكتبة المشتركة libcpu_scheduler (gui/scheduler_api.py)
+ *
+ * الدوال المصدّرة extern "C" فقط، بنفس الأسماء والمعاملات التي يربطها
+ * ملف Python عبر ctypes. المؤشرات void* هي:
+ * - مصفوفة عمليات من api_create_processes (تُحرر بـ api_free_processes)
+ * - نتيجة من api_run_* (تُحرر بـ api_free_result)
+ *
+ * كل نتيجة مستقلة، والحالة العامة الوحيدة هي الـ cache المشترك (محمي
+ * بـ mutex)، فيمكن الاستدعاء من عدة threads
+ */
+
+#ifndef C_API_CPP_INCLUDED
+#define C_API_CPP_INCLUDED
+
+#include "api.cpp"
+
+using namespace std;
+
+#if defined(_WIN32)
+#define SCHEDULER_EXPORT __declspec(dllexport)
+#else
+#define SCHEDULER_EXPORT __attribute__((visibility("default")))
+#endif
+
+// عدد الحقول لكل عملية في api_copy_processes ولكل سجل في api_copy_timeline
+const int C_API_PROCESS_FIELDS = 8;
+const int C_API_TIMELINE_FIELDS = 3;
+
+// تشغيل خوارزمية في نتيجة جديدة على الـ heap
+// nullptr لمدخلات غير صحيحة (مثل quantum أقل من 1 لـ Round Robin، كما في serve_request)
+SchedulingResult* c_api_run(int algorithm_id, void* processes, int count, int time_quantum) {
+    if (!processes || count <= 0 || (algorithm_id == 6 && time_quantum < 1)) {
+        return nullptr;
+    }
+    SchedulingResult* result = (SchedulingResult*)calloc(1, sizeof(SchedulingResult));
+    if (!run_algorithm_cached(*result, algorithm_id, (Process*)processes, count,
+                              time_quantum, 1, SMP_GLOBAL_QUEUE)) {
+        free(result);
+        return nullptr;
+    }
+    return result;
+}
+
+extern "C" {
+
+// ==========================================
+// العمليات
+// ==========================================
+SCHEDULER_EXPORT void* api_create_processes(int count) {
+    return calloc(count > 0 ? count : 1, sizeof(Process));
+}
+
+SCHEDULER_EXPORT void api_free_processes(void* processes) {
+    free(processes);
+}
+
+SCHEDULER_EXPORT void api_set_process(void* processes, int index, int id, int arrival, int burst, int priority) {
+    ((Process*)processes)[index] = create_process(id, arrival, burst, priority);
+}
+
+// ==========================================
+// الخوارزميات
+// ==========================================
+SCHEDULER_EXPORT void* api_run_fcfs(void* processes, int count) {
+    return c_api_run(1, processes, count, DEFAULT_TIME_QUANTUM);
+}
+
+SCHEDULER_EXPORT void* api_run_sjf_non_preemptive(void* processes, int count) {
+    return c_api_run(2, processes, count, DEFAULT_TIME_QUANTUM);
+}
+
+SCHEDULER_EXPORT void* api_run_sjf_preemptive(void* processes, int count) {
+    return c_api_run(3, processes, count, DEFAULT_TIME_QUANTUM);
+}
+
+SCHEDULER_EXPORT void* api_run_priority_non_preemptive(void* processes, int count) {
+    return c_api_run(4, processes, count, DEFAULT_TIME_QUANTUM);
+}
+
+SCHEDULER_EXPORT void* api_run_priority_preemptive(void* processes, int count) {
+    return c_api_run(5, processes, count, DEFAULT_TIME_QUANTUM);
+}
+
+SCHEDULER_EXPORT void* api_run_round_robin(void* processes, int count, int time_quantum) {
+    return c_api_run(6, processes, count, time_quantum);
+}
+
+// ==========================================
+// قراءة النتيجة
+// ==========================================
+SCHEDULER_EXPORT double api_get_avg_waiting_time(void* result) {
+    return ((SchedulingResult*)result)->avg_waiting_time;
+}
+
+SCHEDULER_EXPORT double api_get_avg_turnaround_time(void* result) {
+    return ((SchedulingResult*)result)->avg_turnaround_time;
+}
+
+SCHEDULER_EXPORT double api_get_cpu_utilization(void* result) {
+    return ((SchedulingResult*)result)->cpu_utilization;
+}
+
+SCHEDULER_EXPORT int api_get_timeline_length(void* result) {
+    return ((SchedulingResult*)result)->timeline_length;
+}
+
+SCHEDULER_EXPORT const char* api_get_algorithm_name(void* result) {
+    return ((SchedulingResult*)result)->algorithm_name;
+}
+
+SCHEDULER_EXPORT int api_get_process_count(void* result) {
+    return ((SchedulingResult*)result)->process_count;
+}
+
+// out: process_count * 8 أعداد لكل عملية بالترتيب
+// id, arrival, burst, priority, waiting, turnaround, completion, start
+SCHEDULER_EXPORT void api_copy_processes(void* result, int* out) {
+    const SchedulingResult& r = *(SchedulingResult*)result;
+    for (int i = 0; i < r.process_count; i++) {
+        const Process& p = r.processes[i];
+        int* row = out + (size_t)i * C_API_PROCESS_FIELDS;
+        row[0] = p.id;
+        row[1] = p.arrival_time;
+        row[2] = p.burst_time;
+        row[3] = p.priority;
+        row[4] = p.waiting_time;
+        row[5] = p.turnaround_time;
+        row[6] = p.completion_time;
+        row[7] = p.start_time;
+    }
+}
+
+// out: timeline_length * 3 أعداد لكل سجل: process_id, start, end
+SCHEDULER_EXPORT void api_copy_timeline(void* result, int* out) {
+    const SchedulingResult& r = *(SchedulingResult*)result;
+    for (int i = 0; i < r.timeline_length; i++) {
+        int* row = out + (size_t)i * C_API_TIMELINE_FIELDS;
+        row[0] = r.timeline[i].process_id;
+        row[1] = r.timeline[i].start_time;
+        row[2] = r.timeline[i].end_time;
+    }
+}
+
+SCHEDULER_EXPORT void api_free_result(void* result) {
+    if (!result) return;
+    result_destroy(*(SchedulingResult*)result);
+    free(result);
+}
+
+// ==========================================
+// الـ cache
+// ==========================================
+SCHEDULER_EXPORT long long api_get_cache_hits() {
+    return api_get_cache_stats().hits;
+}
+
+SCHEDULER_EXPORT long long api_get_cache_misses() {
+    return api_get_cache_stats().misses;
+}
+
+SCHEDULER_EXPORT int api_get_cache_entries() {
+    return api_get_cache_stats().entries;
+}
+
+// limit_bytes = 0 يعطل الـ cache
+SCHEDULER_EXPORT void api_set_cache_limit(long long limit_bytes) {
+    result_cache_set_limit(limit_bytes > 0 ? (size_t)limit_bytes : 0);
+}
+
+SCHEDULER_EXPORT void api_clear_cache() {
+    result_cache_clear();
+}
+
+} // extern "C"
+
+#endif // C_API_CPP_INCLUDED
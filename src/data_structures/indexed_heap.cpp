@@ -0,0 +1,216 @@
+/**
+ * @file indexed_heap.cpp
+ * @brief طابور أولوية مفهرس (Indexed 4-ary Min-Heap)
+ * 
+ * كل عنصر يُعرف بفهرس العملية (handle) ويُحفظ موقعه في الـ heap
+ * فيمكن تعديل مفتاح عنصر واحد أو حذفه في O(log n)
+ * بدلاً من إعادة بناء الـ heap أو البحث الخطي
+ * 
+ * 4 أبناء لكل عقدة: شجرة أقل عمقاً وأبناء متجاورون في الذاكرة
+ */
+
+#ifndef INDEXED_HEAP_CPP_INCLUDED
+#define INDEXED_HEAP_CPP_INCLUDED
+
+#include "priority_queue.cpp"
+
+using namespace std;
+
+// ==========================================
+// هيكل الـ Heap المفهرس
+// ==========================================
+template <typename Order>
+struct IndexedHeap {
+    HeapEntry* entries;
+    int* position;          // position[index] = موقع العملية في الـ heap أو -1
+    int capacity;
+    int index_capacity;     // حجم مصفوفة position
+    int size;
+};
+
+// ==========================================
+// دوال مساعدة داخلية
+// ==========================================
+
+// وضع عنصر في موقع مع تحديث خريطة المواقع
+template <typename Order>
+void iheap_place(IndexedHeap<Order>* heap, int slot, const HeapEntry& entry) {
+    heap->entries[slot] = entry;
+    heap->position[entry.index] = slot;
+}
+
+// رفع عنصر من موقع hole حتى يستقر
+template <typename Order>
+void iheap_sift_up(IndexedHeap<Order>* heap, int hole, HeapEntry entry) {
+    while (hole > 0) {
+        int parent = (hole - 1) / 4;
+        if (!Order::less(entry, heap->entries[parent])) break;
+        iheap_place(heap, hole, heap->entries[parent]);
+        hole = parent;
+    }
+    iheap_place(heap, hole, entry);
+}
+
+// خفض عنصر من موقع hole حتى يستقر
+template <typename Order>
+void iheap_sift_down(IndexedHeap<Order>* heap, int hole, HeapEntry entry) {
+    while (true) {
+        int first = 4 * hole + 1;
+        if (first >= heap->size) break;
+        
+        int last = (first + 4 < heap->size) ? first + 4 : heap->size;
+        int best = first;
+        for (int child = first + 1; child < last; child++) {
+            if (Order::less(heap->entries[child], heap->entries[best])) {
+                best = child;
+            }
+        }
+        if (!Order::less(heap->entries[best], entry)) break;
+        iheap_place(heap, hole, heap->entries[best]);
+        hole = best;
+    }
+    iheap_place(heap, hole, entry);
+}
+
+// ==========================================
+// دوال الـ Heap المفهرس
+// ==========================================
+
+// إنشاء heap لفهارس في المجال [0, index_capacity)
+template <typename Order>
+IndexedHeap<Order>* iheap_create(int index_capacity) {
+    if (index_capacity < 1) index_capacity = 1;
+    IndexedHeap<Order>* heap = (IndexedHeap<Order>*)malloc(sizeof(IndexedHeap<Order>));
+    heap->capacity = 16;
+    heap->entries = (HeapEntry*)malloc(sizeof(HeapEntry) * heap->capacity);
+    heap->index_capacity = index_capacity;
+    heap->position = (int*)malloc(sizeof(int) * index_capacity);
+    for (int i = 0; i < index_capacity; i++) {
+        heap->position[i] = -1;
+    }
+    heap->size = 0;
+    return heap;
+}
+
+// تدمير الـ heap
+template <typename Order>
+void iheap_destroy(IndexedHeap<Order>* heap) {
+    if (!heap) return;
+    free(heap->entries);
+    free(heap->position);
+    free(heap);
+}
+
+// التحقق من أن الـ heap فارغ
+template <typename Order>
+bool iheap_is_empty(IndexedHeap<Order>* heap) {
+    return heap->size == 0;
+}
+
+// الحصول على الحجم
+template <typename Order>
+int iheap_get_size(IndexedHeap<Order>* heap) {
+    return heap->size;
+}
+
+// هل العملية ذات الفهرس index موجودة في الـ heap؟
+template <typename Order>
+bool iheap_contains(IndexedHeap<Order>* heap, int index) {
+    return index >= 0 && index < heap->index_capacity && heap->position[index] != -1;
+}
+
+// إدخال عنصر (index هو entry.index)
+template <typename Order>
+void iheap_push_entry(IndexedHeap<Order>* heap, HeapEntry entry) {
+    int index = entry.index;
+    if (heap->size >= heap->capacity) {
+        heap->capacity *= 2;
+        heap->entries = (HeapEntry*)realloc(heap->entries, sizeof(HeapEntry) * heap->capacity);
+    }
+    if (index >= heap->index_capacity) {
+        int old_capacity = heap->index_capacity;
+        while (index >= heap->index_capacity) heap->index_capacity *= 2;
+        heap->position = (int*)realloc(heap->position, sizeof(int) * heap->index_capacity);
+        for (int i = old_capacity; i < heap->index_capacity; i++) {
+            heap->position[i] = -1;
+        }
+    }
+    iheap_sift_up(heap, heap->size++, entry);
+}
+
+// إدخال عملية بفهرسها
+template <typename Order>
+void iheap_push(IndexedHeap<Order>* heap, const Process& p, int index) {
+    iheap_push_entry(heap, Order::entry(p, index));
+}
+
+// إدخال عملية من جدول العمليات (SoA)
+template <typename Order>
+void iheap_push(IndexedHeap<Order>* heap, const ProcessTable& table, int index) {
+    iheap_push_entry(heap, Order::entry(table, index));
+}
+
+// فهرس العملية في القمة (-1 إذا كان فارغاً)
+template <typename Order>
+int iheap_peek(IndexedHeap<Order>* heap) {
+    return heap->size > 0 ? heap->entries[0].index : -1;
+}
+
+// حذف عملية بفهرسها من أي موقع
+template <typename Order>
+void iheap_erase(IndexedHeap<Order>* heap, int index) {
+    if (!iheap_contains(heap, index)) return;
+    
+    int slot = heap->position[index];
+    HeapEntry removed = heap->entries[slot];
+    HeapEntry last = heap->entries[--heap->size];
+    heap->position[index] = -1;
+    if (slot == heap->size) return;
+    
+    if (Order::less(last, removed)) {
+        iheap_sift_up(heap, slot, last);
+    } else {
+        iheap_sift_down(heap, slot, last);
+    }
+}
+
+// استخراج فهرس العملية في القمة
+template <typename Order>
+int iheap_pop(IndexedHeap<Order>* heap) {
+    int top = iheap_peek(heap);
+    iheap_erase(heap, top);
+    return top;
+}
+
+// تصغير مفتاح عملية (مثل الوقت المتبقي بعد التنفيذ)
+template <typename Order>
+void iheap_decrease_key(IndexedHeap<Order>* heap, int index, int key) {
+    if (!iheap_contains(heap, index)) return;
+    int slot = heap->position[index];
+    HeapEntry entry = heap->entries[slot];
+    entry.key = key;
+    iheap_sift_up(heap, slot, entry);
+}
+
+// تكبير مفتاح عملية
+template <typename Order>
+void iheap_increase_key(IndexedHeap<Order>* heap, int index, int key) {
+    if (!iheap_contains(heap, index)) return;
+    int slot = heap->position[index];
+    HeapEntry entry = heap->entries[slot];
+    entry.key = key;
+    iheap_sift_down(heap, slot, entry);
+}
+
+// تعديل مفتاح عملية في أي اتجاه (مثل سياسات الـ Aging)
+template <typename Order>
+void iheap_update_key(IndexedHeap<Order>* heap, int index, int key) {
+    if (!iheap_contains(heap, index)) return;
+    if (key < heap->entries[heap->position[index]].key) {
+        iheap_decrease_key(heap, index, key);
+    } else {
+        iheap_increase_key(heap, index, key);
+    }
+}
+
+#endif // INDEXED_HEAP_CPP_INCLUDED
@@ -9,7 +9,7 @@
 #ifndef LINKED_LIST_CPP_INCLUDED
 #define LINKED_LIST_CPP_INCLUDED
 
-#include "../types.cpp"
+#include "node_arena.cpp"
 
 using namespace std;
 
@@ -18,10 +18,12 @@ using namespace std;
 // ==========================================
 
 // عقدة القائمة
+// next أول حقل حتى تكون السلسلة head -> tail قائمة حرة للـ Arena
 struct ListNode {
-    Process data;
     ListNode* next;
     ListNode* prev;
+    Process data;
+    int tag;                // فهرس العملية في المصفوفة الأصلية (-1 إن لم يُحدد)
 };
 
 // هيكل القائمة المترابطة
@@ -29,30 +31,41 @@ struct LinkedList {
     ListNode* head;
     ListNode* tail;
     int size;
+    NodeArena* arena;       // مصدر العقد
+    bool on_default_arena;  // العقد تعود إلى الـ Arena الافتراضية عند التدمير
 };
 
 // ==========================================
 // دوال القائمة المترابطة
 // ==========================================
 
-// إنشاء قائمة جديدة
-LinkedList* list_create() {
+// إنشاء قائمة تأخذ عقدها من Arena مشتركة
+// عقدها تُحرر مع arena_reset أو arena_destroy وليس مع list_destroy
+LinkedList* list_create_in(NodeArena* arena) {
     LinkedList* list = (LinkedList*)malloc(sizeof(LinkedList));
     list->head = nullptr;
     list->tail = nullptr;
     list->size = 0;
+    list->arena = arena;
+    list->on_default_arena = false;
     return list;
 }
 
-// تدمير القائمة
+// إنشاء قائمة جديدة (على الـ Arena الافتراضية لهذا الـ thread)
+// تُستخدم وتُدمر في نفس الـ thread الذي أنشأها
+LinkedList* list_create() {
+    LinkedList* list = list_create_in(arena_default());
+    list->on_default_arena = true;
+    return list;
+}
+
+// تدمير القائمة - O(1)
+// على الـ Arena الافتراضية تعود السلسلة كاملة إلى القائمة الحرة دفعة واحدة
+// وعلى Arena مشتركة تبقى العقد حتى arena_reset أو arena_destroy
 void list_destroy(LinkedList* list) {
     if (!list) return;
-    
-    ListNode* current = list->head;
-    while (current) {
-        ListNode* temp = current;
-        current = current->next;
-        free(temp);
+    if (list->on_default_arena) {
+        arena_free_chain(list->arena, list->head, list->tail, sizeof(ListNode));
     }
     free(list);
 }
@@ -62,10 +75,11 @@ bool list_is_empty(LinkedList* list) {
     return list->size == 0;
 }
 
-// إدراج في البداية
-void list_insert_front(LinkedList* list, Process p) {
-    ListNode* node = (ListNode*)malloc(sizeof(ListNode));
+// إدراج في البداية مع فهرس العملية
+void list_insert_front_tagged(LinkedList* list, Process p, int tag) {
+    ListNode* node = (ListNode*)arena_alloc(list->arena, sizeof(ListNode));
     node->data = p;
+    node->tag = tag;
     node->prev = nullptr;
     node->next = list->head;
     
@@ -80,10 +94,16 @@ void list_insert_front(LinkedList* list, Process p) {
     list->size++;
 }
 
-// إدراج في النهاية
-void list_insert_back(LinkedList* list, Process p) {
-    ListNode* node = (ListNode*)malloc(sizeof(ListNode));
+// إدراج في البداية
+void list_insert_front(LinkedList* list, Process p) {
+    list_insert_front_tagged(list, p, -1);
+}
+
+// إدراج في النهاية مع فهرس العملية
+void list_insert_back_tagged(LinkedList* list, Process p, int tag) {
+    ListNode* node = (ListNode*)arena_alloc(list->arena, sizeof(ListNode));
     node->data = p;
+    node->tag = tag;
     node->next = nullptr;
     node->prev = list->tail;
     
@@ -98,14 +118,21 @@ void list_insert_back(LinkedList* list, Process p) {
     list->size++;
 }
 
-// حذف من البداية
-Process list_remove_front(LinkedList* list) {
+// إدراج في النهاية
+void list_insert_back(LinkedList* list, Process p) {
+    list_insert_back_tagged(list, p, -1);
+}
+
+// حذف من البداية مع فهرس العملية
+Process list_remove_front_tagged(LinkedList* list, int* tag) {
     if (list_is_empty(list)) {
+        if (tag) *tag = -1;
         return create_process(-1, 0, 0, 0);
     }
     
     ListNode* temp = list->head;
     Process data = temp->data;
+    if (tag) *tag = temp->tag;
     list->head = list->head->next;
     
     if (list->head) {
@@ -114,19 +141,26 @@ Process list_remove_front(LinkedList* list) {
         list->tail = nullptr;
     }
     
-    free(temp);
+    arena_free(list->arena, temp, sizeof(ListNode));
     list->size--;
     return data;
 }
 
-// حذف من النهاية
-Process list_remove_back(LinkedList* list) {
+// حذف من البداية
+Process list_remove_front(LinkedList* list) {
+    return list_remove_front_tagged(list, nullptr);
+}
+
+// حذف من النهاية مع فهرس العملية
+Process list_remove_back_tagged(LinkedList* list, int* tag) {
     if (list_is_empty(list)) {
+        if (tag) *tag = -1;
         return create_process(-1, 0, 0, 0);
     }
     
     ListNode* temp = list->tail;
     Process data = temp->data;
+    if (tag) *tag = temp->tag;
     list->tail = list->tail->prev;
     
     if (list->tail) {
@@ -135,11 +169,16 @@ Process list_remove_back(LinkedList* list) {
         list->head = nullptr;
     }
     
-    free(temp);
+    arena_free(list->arena, temp, sizeof(ListNode));
     list->size--;
     return data;
 }
 
+// حذف من النهاية
+Process list_remove_back(LinkedList* list) {
+    return list_remove_back_tagged(list, nullptr);
+}
+
 // حذف عقدة محددة
 void list_remove_node(LinkedList* list, ListNode* node) {
     if (!node) return;
@@ -156,7 +195,7 @@ void list_remove_node(LinkedList* list, ListNode* node) {
         list->tail = node->prev;
     }
     
-    free(node);
+    arena_free(list->arena, node, sizeof(ListNode));
     list->size--;
 }
 
@@ -0,0 +1,185 @@
+/**
+ * @file node_arena.cpp
+ * @brief مخصص ذاكرة للعقد (Arena + Free Lists)
+ * 
+ * بدلاً من malloc/free لكل عقدة، تُقتطع العقد من كتل كبيرة (chunks)
+ * والعقد المحررة تعود إلى قائمة حرة حسب حجمها لإعادة استخدامها
+ * تحرير الـ Arena أو إعادة تهيئتها يحرر كل العقد دفعة واحدة
+ * 
+ * تستخدمها Stack و ExecutionStack و LinkedList
+ * (الطابور Queue مصفوفة دائرية ولا يحتاج عقداً)
+ *
+ * البنى المنشأة بدون Arena محددة (stack_create و list_create ...)
+ * تشترك في Arena افتراضية واحدة لكل thread، فلا تحجز كل بنية كتلة خاصة
+ */
+
+#ifndef NODE_ARENA_CPP_INCLUDED
+#define NODE_ARENA_CPP_INCLUDED
+
+#include "../types.cpp"
+
+using namespace std;
+
+// ==========================================
+// الثوابت
+// ==========================================
+const int ARENA_FIRST_CHUNK_SIZE = 1024;        // الكتل تتضاعف حتى الحد الأقصى
+const int ARENA_MAX_CHUNK_SIZE = 64 * 1024;
+const int ARENA_ALIGNMENT = 16;
+const int ARENA_SIZE_CLASSES = 16;      // أحجام 8, 16, ..., 128 بايت
+
+// ==========================================
+// هياكل الـ Arena
+// ==========================================
+
+// كتلة ذاكرة كبيرة تُقتطع منها العقد
+struct ArenaChunk {
+    ArenaChunk* next;
+    int size;                   // المساحة القابلة للاستخدام بالبايت
+};
+
+// عقدة محررة في القائمة الحرة
+struct ArenaFreeSlot {
+    ArenaFreeSlot* next;
+};
+
+// هيكل الـ Arena
+struct NodeArena {
+    ArenaChunk* chunks;         // كل الكتل بترتيب الحجز
+    ArenaChunk* current;        // الكتلة التي يُقتطع منها حالياً
+    char* cursor;
+    char* limit;
+    ArenaFreeSlot* free_lists[ARENA_SIZE_CLASSES];
+};
+
+// ==========================================
+// دوال مساعدة داخلية
+// ==========================================
+
+// بداية المساحة القابلة للاستخدام داخل الكتلة
+char* arena_chunk_begin(ArenaChunk* chunk) {
+    return (char*)chunk + ARENA_ALIGNMENT;
+}
+
+// الانتقال إلى الكتلة التالية (أو حجز كتلة جديدة)
+void arena_next_chunk(NodeArena* arena) {
+    ArenaChunk* next = arena->current ? arena->current->next : arena->chunks;
+    if (!next) {
+        int size = ARENA_FIRST_CHUNK_SIZE;
+        if (arena->current) {
+            size = arena->current->size * 2;
+            if (size > ARENA_MAX_CHUNK_SIZE) size = ARENA_MAX_CHUNK_SIZE;
+        }
+        next = (ArenaChunk*)malloc(ARENA_ALIGNMENT + size);
+        next->next = nullptr;
+        next->size = size;
+        if (arena->current) {
+            arena->current->next = next;
+        } else {
+            arena->chunks = next;
+        }
+    }
+    arena->current = next;
+    arena->cursor = arena_chunk_begin(next);
+    arena->limit = arena->cursor + next->size;
+}
+
+// ==========================================
+// دوال الـ Arena
+// ==========================================
+
+// إنشاء Arena جديدة
+NodeArena* arena_create() {
+    NodeArena* arena = (NodeArena*)malloc(sizeof(NodeArena));
+    arena->chunks = nullptr;
+    arena->current = nullptr;
+    arena->cursor = nullptr;
+    arena->limit = nullptr;
+    for (int i = 0; i < ARENA_SIZE_CLASSES; i++) {
+        arena->free_lists[i] = nullptr;
+    }
+    return arena;
+}
+
+// حجز عقدة (size لا يتجاوز 128 بايت)
+void* arena_alloc(NodeArena* arena, int size) {
+    int size_class = (size + 7) / 8 - 1;
+    ArenaFreeSlot* slot = arena->free_lists[size_class];
+    if (slot) {
+        arena->free_lists[size_class] = slot->next;
+        return slot;
+    }
+    
+    int rounded = (size_class + 1) * 8;
+    if (!arena->cursor || arena->cursor + rounded > arena->limit) {
+        arena_next_chunk(arena);
+    }
+    void* node = arena->cursor;
+    arena->cursor += rounded;
+    return node;
+}
+
+// إرجاع عقدة إلى القائمة الحرة لحجمها
+void arena_free(NodeArena* arena, void* node, int size) {
+    if (!node) return;
+    int size_class = (size + 7) / 8 - 1;
+    ArenaFreeSlot* slot = (ArenaFreeSlot*)node;
+    slot->next = arena->free_lists[size_class];
+    arena->free_lists[size_class] = slot;
+}
+
+// إرجاع سلسلة عقد كاملة إلى القائمة الحرة في O(1)
+// يشترط أن يكون مؤشر next أول حقل في العقدة (مثل ArenaFreeSlot)
+// فتكون السلسلة first -> ... -> last قائمة حرة جاهزة
+void arena_free_chain(NodeArena* arena, void* first, void* last, int size) {
+    if (!first) return;
+    int size_class = (size + 7) / 8 - 1;
+    ((ArenaFreeSlot*)last)->next = arena->free_lists[size_class];
+    arena->free_lists[size_class] = (ArenaFreeSlot*)first;
+}
+
+// تحرير كل العقد دفعة واحدة مع الاحتفاظ بالكتل لإعادة استخدامها
+void arena_reset(NodeArena* arena) {
+    arena->current = nullptr;
+    arena->cursor = nullptr;
+    arena->limit = nullptr;
+    for (int i = 0; i < ARENA_SIZE_CLASSES; i++) {
+        arena->free_lists[i] = nullptr;
+    }
+}
+
+// تدمير الـ Arena وكل كتلها
+void arena_destroy(NodeArena* arena) {
+    if (!arena) return;
+    
+    ArenaChunk* chunk = arena->chunks;
+    while (chunk) {
+        ArenaChunk* temp = chunk;
+        chunk = chunk->next;
+        free(temp);
+    }
+    free(arena);
+}
+
+// ==========================================
+// الـ Arena الافتراضية
+// ==========================================
+// تُنشأ عند أول استخدام في كل thread وتُدمر عند انتهائه، لذلك البنية
+// المنشأة عليها يجب أن تُستخدم وتُدمر في نفس الـ thread وألا تعيش بعده
+// (تدميرها من thread آخر يعيد العقد إلى Arena ذلك الـ thread)
+// لا تُعاد تهيئتها أبداً: كل بنية تعيد سلسلة عقدها كاملة إلى القائمة
+// الحرة عند تدميرها بـ arena_free_chain في O(1)
+struct ArenaDefaultHolder {
+    NodeArena* arena = nullptr;
+    ~ArenaDefaultHolder() { arena_destroy(arena); }
+};
+
+NodeArena* arena_default() {
+    static thread_local ArenaDefaultHolder holder;
+    if (!holder.arena) {
+        holder.arena = arena_create();
+    }
+    return holder.arena;
+}
+
+#endif // NODE_ARENA_CPP_INCLUDED
@@ -24,22 +24,31 @@ typedef bool (*CompareFunction)(const Process&, const Process&);
 
 // مقارنة حسب وقت التنفيذ (للـ SJF)
 bool compare_by_burst_time(const Process& a, const Process& b) {
-    if (a.burst_time == b.burst_time)
+    if (a.burst_time == b.burst_time) {
+        if (a.arrival_time == b.arrival_time)
+            return a.id < b.id;
         return a.arrival_time < b.arrival_time;
+    }
     return a.burst_time < b.burst_time;
 }
 
 // مقارنة حسب الوقت المتبقي (للـ SRTF)
 bool compare_by_remaining_time(const Process& a, const Process& b) {
-    if (a.remaining_time == b.remaining_time)
+    if (a.remaining_time == b.remaining_time) {
+        if (a.arrival_time == b.arrival_time)
+            return a.id < b.id;
         return a.arrival_time < b.arrival_time;
+    }
     return a.remaining_time < b.remaining_time;
 }
 
 // مقارنة حسب الأولوية
 bool compare_by_priority(const Process& a, const Process& b) {
-    if (a.priority == b.priority)
+    if (a.priority == b.priority) {
+        if (a.arrival_time == b.arrival_time)
+            return a.id < b.id;
         return a.arrival_time < b.arrival_time;
+    }
     return a.priority < b.priority;
 }
 
@@ -84,19 +93,22 @@ void pq_heapify_up(PriorityQueue* pq, int index) {
 
 // إعادة ترتيب للأسفل (بعد الحذف)
 void pq_heapify_down(PriorityQueue* pq, int index) {
-    int smallest = index;
-    int left = 2 * index + 1;
-    int right = 2 * index + 2;
-    
-    if (left < pq->size && pq->compare(pq->heap[left], pq->heap[smallest])) {
-        smallest = left;
-    }
-    if (right < pq->size && pq->compare(pq->heap[right], pq->heap[smallest])) {
-        smallest = right;
-    }
-    if (smallest != index) {
+    while (true) {
+        int smallest = index;
+        int left = 2 * index + 1;
+        int right = 2 * index + 2;
+        
+        if (left < pq->size && pq->compare(pq->heap[left], pq->heap[smallest])) {
+            smallest = left;
+        }
+        if (right < pq->size && pq->compare(pq->heap[right], pq->heap[smallest])) {
+            smallest = right;
+        }
+        if (smallest == index) {
+            break;
+        }
         pq_swap(pq->heap[index], pq->heap[smallest]);
-        pq_heapify_down(pq, smallest);
+        index = smallest;
     }
 }
 
@@ -105,7 +117,8 @@ void pq_heapify_down(PriorityQueue* pq, int index) {
 // ==========================================
 
 // إنشاء طابور أولوية جديد
-PriorityQueue* pq_create(CompareFunction cmp, int capacity = MAX_PROCESSES) {
+PriorityQueue* pq_create(CompareFunction cmp, int capacity = 16) {
+    if (capacity < 1) capacity = 1;
     PriorityQueue* pq = (PriorityQueue*)malloc(sizeof(PriorityQueue));
     pq->heap = (Process*)malloc(sizeof(Process) * capacity);
     pq->capacity = capacity;
@@ -128,7 +141,11 @@ bool pq_is_empty(PriorityQueue* pq) {
 
 // إدخال عنصر
 void pq_insert(PriorityQueue* pq, Process p) {
-    if (pq->size >= pq->capacity) return;
+    // توسيع المصفوفة عند امتلائها
+    if (pq->size >= pq->capacity) {
+        pq->capacity *= 2;
+        pq->heap = (Process*)realloc(pq->heap, sizeof(Process) * pq->capacity);
+    }
     pq->heap[pq->size] = p;
     pq_heapify_up(pq, pq->size);
     pq->size++;
@@ -166,4 +183,191 @@ void pq_rebuild(PriorityQueue* pq) {
     }
 }
 
+// ==========================================
+// طابور أولوية قالبي (Template) للخوارزميات
+// ==========================================
+// يخزن أزواج (مفتاح، فهرس) صغيرة بدلاً من العمليات كاملة
+// وترتيبه معروف وقت الترجمة فيمكن للمترجم تضمين المقارنة (inline)
+// بدلاً من استدعائها عبر مؤشر دالة
+
+// عنصر الـ heap
+struct HeapEntry {
+    int key;        // المفتاح الأساسي (وقت التنفيذ / المتبقي / الأولوية / الوصول)
+    int tie;        // كاسر التعادل (وقت الوصول)
+    int index;      // فهرس العملية في المصفوفة (كاسر التعادل الأخير)
+};
+
+// ترتيب معجمي: المفتاح ثم وقت الوصول ثم الفهرس
+struct LexicographicOrder {
+    static bool less(const HeapEntry& a, const HeapEntry& b) {
+        if (a.key != b.key) return a.key < b.key;
+        if (a.tie != b.tie) return a.tie < b.tie;
+        return a.index < b.index;
+    }
+};
+
+// ==========================================
+// سياسات الترتيب الجاهزة (تقابل دوال compare_by_*)
+// ==========================================
+
+// حسب وقت التنفيذ (للـ SJF)
+struct ByBurstTime : LexicographicOrder {
+    static HeapEntry entry(const Process& p, int index) {
+        HeapEntry e = {p.burst_time, p.arrival_time, index};
+        return e;
+    }
+    static HeapEntry entry(const ProcessTable& t, int index) {
+        HeapEntry e = {t.burst_time[index], t.arrival_time[index], index};
+        return e;
+    }
+};
+
+// حسب الوقت المتبقي (للـ SRTF)
+struct ByRemainingTime : LexicographicOrder {
+    static HeapEntry entry(const Process& p, int index) {
+        HeapEntry e = {p.remaining_time, p.arrival_time, index};
+        return e;
+    }
+    static HeapEntry entry(const ProcessTable& t, int index) {
+        HeapEntry e = {t.remaining_time[index], t.arrival_time[index], index};
+        return e;
+    }
+};
+
+// حسب الأولوية
+struct ByPriority : LexicographicOrder {
+    static HeapEntry entry(const Process& p, int index) {
+        HeapEntry e = {p.priority, p.arrival_time, index};
+        return e;
+    }
+    static HeapEntry entry(const ProcessTable& t, int index) {
+        HeapEntry e = {t.priority[index], t.arrival_time[index], index};
+        return e;
+    }
+};
+
+// حسب وقت الوصول
+struct ByArrivalTime : LexicographicOrder {
+    static HeapEntry entry(const Process& p, int index) {
+        HeapEntry e = {p.arrival_time, 0, index};
+        return e;
+    }
+    static HeapEntry entry(const ProcessTable& t, int index) {
+        HeapEntry e = {t.arrival_time[index], 0, index};
+        return e;
+    }
+};
+
+// ==========================================
+// هيكل الـ Min-Heap القالبي
+// ==========================================
+template <typename Order>
+struct MinHeap {
+    HeapEntry* entries;
+    int capacity;
+    int size;
+};
+
+// ==========================================
+// دوال الـ Min-Heap القالبي
+// ==========================================
+
+// إنشاء heap جديد
+template <typename Order>
+MinHeap<Order>* heap_create(int capacity = 16) {
+    if (capacity < 1) capacity = 1;
+    MinHeap<Order>* heap = (MinHeap<Order>*)malloc(sizeof(MinHeap<Order>));
+    heap->entries = (HeapEntry*)malloc(sizeof(HeapEntry) * capacity);
+    heap->capacity = capacity;
+    heap->size = 0;
+    return heap;
+}
+
+// نسخة مستقلة من الـ heap
+template <typename Order>
+MinHeap<Order>* heap_clone(const MinHeap<Order>* heap) {
+    MinHeap<Order>* copy = heap_create<Order>(heap->capacity);
+    memcpy(copy->entries, heap->entries, sizeof(HeapEntry) * heap->size);
+    copy->size = heap->size;
+    return copy;
+}
+
+// تدمير الـ heap
+template <typename Order>
+void heap_destroy(MinHeap<Order>* heap) {
+    if (!heap) return;
+    free(heap->entries);
+    free(heap);
+}
+
+// التحقق من أن الـ heap فارغ
+template <typename Order>
+bool heap_is_empty(MinHeap<Order>* heap) {
+    return heap->size == 0;
+}
+
+// الحصول على الحجم
+template <typename Order>
+int heap_get_size(MinHeap<Order>* heap) {
+    return heap->size;
+}
+
+// إدخال عنصر (رفع تكراري: نحرك "الفراغ" بدلاً من التبديل)
+template <typename Order>
+void heap_push_entry(MinHeap<Order>* heap, HeapEntry entry) {
+    if (heap->size >= heap->capacity) {
+        heap->capacity *= 2;
+        heap->entries = (HeapEntry*)realloc(heap->entries, sizeof(HeapEntry) * heap->capacity);
+    }
+    
+    int hole = heap->size++;
+    while (hole > 0) {
+        int parent = (hole - 1) / 2;
+        if (!Order::less(entry, heap->entries[parent])) break;
+        heap->entries[hole] = heap->entries[parent];
+        hole = parent;
+    }
+    heap->entries[hole] = entry;
+}
+
+// إدخال عملية بفهرسها
+template <typename Order>
+void heap_push(MinHeap<Order>* heap, const Process& p, int index) {
+    heap_push_entry(heap, Order::entry(p, index));
+}
+
+// إدخال عملية من جدول العمليات (SoA)
+template <typename Order>
+void heap_push(MinHeap<Order>* heap, const ProcessTable& table, int index) {
+    heap_push_entry(heap, Order::entry(table, index));
+}
+
+// فهرس العملية في القمة (-1 إذا كان فارغاً)
+template <typename Order>
+int heap_peek(MinHeap<Order>* heap) {
+    return heap->size > 0 ? heap->entries[0].index : -1;
+}
+
+// استخراج فهرس العملية في القمة (خفض تكراري)
+template <typename Order>
+int heap_pop(MinHeap<Order>* heap) {
+    if (heap->size == 0) return -1;
+    
+    int top = heap->entries[0].index;
+    HeapEntry last = heap->entries[--heap->size];
+    int hole = 0;
+    while (true) {
+        int child = 2 * hole + 1;
+        if (child >= heap->size) break;
+        if (child + 1 < heap->size && Order::less(heap->entries[child + 1], heap->entries[child])) {
+            child++;
+        }
+        if (!Order::less(heap->entries[child], last)) break;
+        heap->entries[hole] = heap->entries[child];
+        hole = child;
+    }
+    heap->entries[hole] = last;
+    return top;
+}
+
 #endif // PRIORITY_QUEUE_CPP_INCLUDED
@@ -4,6 +4,12 @@
  * 
  * الطابور يعمل بمبدأ FIFO (First In First Out)
  * أول عنصر يدخل هو أول عنصر يخرج
+ * 
+ * مبني على مصفوفة دائرية (Ring Buffer) تتوسع عند امتلائها
+ * فلا يحتاج أي حجز ذاكرة لكل عنصر
+ *
+ * IndexQueue بنفس البنية لكنه يحمل فهارس (int) فقط: الخوارزميات تضع فيه
+ * فهرس العملية وتقرأ حقولها من مصفوفة العمليات، فلا تُنسخ Process كاملة
  */
 
 #ifndef QUEUE_CPP_INCLUDED
@@ -14,22 +20,49 @@
 using namespace std;
 
 // ==========================================
-// هياكل الطابور
-// ==========================================
-
-// عقدة الطابور
-struct QueueNode {
-    Process data;
-    QueueNode* next;
-};
-
 // هيكل الطابور
+// ==========================================
 struct Queue {
-    QueueNode* front;
-    QueueNode* rear;
+    Process* data;
+    int capacity;       // دائماً قوة للعدد 2
+    int front;          // موقع أول عنصر
     int size;
 };
 
+// ==========================================
+// دوال مساعدة داخلية
+// ==========================================
+
+// مشتركة بين Queue و IndexQueue: تعمل على المصفوفة كبايتات بحجم العنصر
+
+// مضاعفة السعة مع نقل العناصر لتبدأ من الموقع 0
+// العناصر المتصلة تُنسخ على جزأين: من front إلى نهاية المصفوفة ثم من بدايتها
+void ring_grow(void** data, int element_size, int* capacity, int* front, int size) {
+    char* old_data = (char*)*data;
+    char* new_data = (char*)malloc((size_t)element_size * *capacity * 2);
+    
+    int first_part = *capacity - *front;
+    if (first_part > size) first_part = size;
+    memcpy(new_data, old_data + (size_t)*front * element_size, (size_t)first_part * element_size);
+    memcpy(new_data + (size_t)first_part * element_size, old_data, (size_t)(size - first_part) * element_size);
+    
+    free(old_data);
+    *data = new_data;
+    *capacity *= 2;
+    *front = 0;
+}
+
+// نسخة مستقلة من مصفوفة الحلقة (بنفس السعة والمواقع)
+void* ring_clone(const void* data, int element_size, int capacity) {
+    void* copy = malloc((size_t)element_size * capacity);
+    memcpy(copy, data, (size_t)element_size * capacity);
+    return copy;
+}
+
+void queue_grow(Queue* q) {
+    ring_grow((void**)&q->data, sizeof(Process), &q->capacity, &q->front, q->size);
+}
+
 // ==========================================
 // دوال الطابور
 // ==========================================
@@ -37,8 +70,9 @@ struct Queue {
 // إنشاء طابور جديد
 Queue* queue_create() {
     Queue* q = (Queue*)malloc(sizeof(Queue));
-    q->front = nullptr;
-    q->rear = nullptr;
+    q->capacity = 16;
+    q->data = (Process*)malloc(sizeof(Process) * q->capacity);
+    q->front = 0;
     q->size = 0;
     return q;
 }
@@ -46,13 +80,7 @@ Queue* queue_create() {
 // تدمير الطابور وتحرير الذاكرة
 void queue_destroy(Queue* q) {
     if (!q) return;
-    
-    QueueNode* current = q->front;
-    while (current) {
-        QueueNode* temp = current;
-        current = current->next;
-        free(temp);
-    }
+    free(q->data);
     free(q);
 }
 
@@ -63,17 +91,10 @@ bool queue_is_empty(Queue* q) {
 
 // إضافة عنصر للطابور (من الخلف)
 void queue_enqueue(Queue* q, Process p) {
-    QueueNode* node = (QueueNode*)malloc(sizeof(QueueNode));
-    node->data = p;
-    node->next = nullptr;
-    
-    if (queue_is_empty(q)) {
-        q->front = node;
-        q->rear = node;
-    } else {
-        q->rear->next = node;
-        q->rear = node;
+    if (q->size == q->capacity) {
+        queue_grow(q);
     }
+    q->data[(q->front + q->size) & (q->capacity - 1)] = p;
     q->size++;
 }
 
@@ -83,15 +104,8 @@ Process queue_dequeue(Queue* q) {
         return create_process(-1, 0, 0, 0);
     }
     
-    QueueNode* temp = q->front;
-    Process data = temp->data;
-    q->front = q->front->next;
-    
-    if (!q->front) {
-        q->rear = nullptr;
-    }
-    
-    free(temp);
+    Process data = q->data[q->front];
+    q->front = (q->front + 1) & (q->capacity - 1);
     q->size--;
     return data;
 }
@@ -101,7 +115,7 @@ Process queue_peek(Queue* q) {
     if (queue_is_empty(q)) {
         return create_process(-1, 0, 0, 0);
     }
-    return q->front->data;
+    return q->data[q->front];
 }
 
 // الحصول على حجم الطابور
@@ -109,4 +123,64 @@ int queue_get_size(Queue* q) {
     return q->size;
 }
 
+// ==========================================
+// طابور الفهارس
+// ==========================================
+struct IndexQueue {
+    int* data;
+    int capacity;       // دائماً قوة للعدد 2
+    int front;
+    int size;
+};
+
+// إنشاء طابور فهارس جديد
+IndexQueue* index_queue_create() {
+    IndexQueue* q = (IndexQueue*)malloc(sizeof(IndexQueue));
+    q->capacity = 16;
+    q->data = (int*)malloc(sizeof(int) * q->capacity);
+    q->front = 0;
+    q->size = 0;
+    return q;
+}
+
+// نسخة مستقلة (بنفس السعة والترتيب)
+IndexQueue* index_queue_clone(const IndexQueue* q) {
+    IndexQueue* copy = (IndexQueue*)malloc(sizeof(IndexQueue));
+    *copy = *q;
+    copy->data = (int*)ring_clone(q->data, sizeof(int), q->capacity);
+    return copy;
+}
+
+// تدمير الطابور وتحرير الذاكرة
+void index_queue_destroy(IndexQueue* q) {
+    if (!q) return;
+    free(q->data);
+    free(q);
+}
+
+// التحقق من أن الطابور فارغ
+bool index_queue_is_empty(const IndexQueue* q) {
+    return q->size == 0;
+}
+
+// إضافة فهرس (من الخلف)، مع مضاعفة السعة عند الامتلاء
+void index_queue_push(IndexQueue* q, int index) {
+    if (q->size == q->capacity) {
+        ring_grow((void**)&q->data, sizeof(int), &q->capacity, &q->front, q->size);
+    }
+    q->data[(q->front + q->size) & (q->capacity - 1)] = index;
+    q->size++;
+}
+
+// إزالة فهرس (من الأمام)، أو -1 إذا كان الطابور فارغاً
+int index_queue_pop(IndexQueue* q) {
+    if (q->size == 0) {
+        return -1;
+    }
+    int index = q->data[q->front];
+    q->front = (q->front + 1) & (q->capacity - 1);
+    q->size--;
+    return index;
+}
+
 #endif // QUEUE_CPP_INCLUDED
@@ -9,7 +9,7 @@
 #ifndef STACK_CPP_INCLUDED
 #define STACK_CPP_INCLUDED
 
-#include "../types.cpp"
+#include "node_arena.cpp"
 
 using namespace std;
 
@@ -18,38 +18,52 @@ using namespace std;
 // ==========================================
 
 // عقدة المكدس
+// next أول حقل حتى تكون السلسلة top -> bottom قائمة حرة للـ Arena
 struct StackNode {
-    Process data;
     StackNode* next;
+    Process data;
 };
 
 // هيكل المكدس
 struct Stack {
     StackNode* top;
+    StackNode* bottom;      // آخر عقدة في السلسلة (لإعادتها كاملة عند التدمير)
     int size;
+    NodeArena* arena;       // مصدر العقد
+    bool on_default_arena;  // العقد تعود إلى الـ Arena الافتراضية عند التدمير
 };
 
 // ==========================================
 // دوال المكدس
 // ==========================================
 
-// إنشاء مكدس جديد
-Stack* stack_create() {
+// إنشاء مكدس يأخذ عقده من Arena مشتركة
+// عقده تُحرر مع arena_reset أو arena_destroy وليس مع stack_destroy
+Stack* stack_create_in(NodeArena* arena) {
     Stack* s = (Stack*)malloc(sizeof(Stack));
     s->top = nullptr;
+    s->bottom = nullptr;
     s->size = 0;
+    s->arena = arena;
+    s->on_default_arena = false;
     return s;
 }
 
-// تدمير المكدس
+// إنشاء مكدس جديد (على الـ Arena الافتراضية لهذا الـ thread)
+// يُستخدم ويُدمر في نفس الـ thread الذي أنشأه
+Stack* stack_create() {
+    Stack* s = stack_create_in(arena_default());
+    s->on_default_arena = true;
+    return s;
+}
+
+// تدمير المكدس - O(1)
+// على الـ Arena الافتراضية تعود السلسلة كاملة إلى القائمة الحرة دفعة واحدة
+// وعلى Arena مشتركة تبقى العقد حتى arena_reset أو arena_destroy
 void stack_destroy(Stack* s) {
     if (!s) return;
-    
-    StackNode* current = s->top;
-    while (current) {
-        StackNode* temp = current;
-        current = current->next;
-        free(temp);
+    if (s->on_default_arena) {
+        arena_free_chain(s->arena, s->top, s->bottom, sizeof(StackNode));
     }
     free(s);
 }
@@ -61,9 +75,10 @@ bool stack_is_empty(Stack* s) {
 
 // إضافة عنصر (Push)
 void stack_push(Stack* s, Process p) {
-    StackNode* node = (StackNode*)malloc(sizeof(StackNode));
+    StackNode* node = (StackNode*)arena_alloc(s->arena, sizeof(StackNode));
     node->data = p;
     node->next = s->top;
+    if (!s->top) s->bottom = node;
     s->top = node;
     s->size++;
 }
@@ -77,7 +92,8 @@ Process stack_pop(Stack* s) {
     StackNode* temp = s->top;
     Process data = temp->data;
     s->top = s->top->next;
-    free(temp);
+    if (!s->top) s->bottom = nullptr;
+    arena_free(s->arena, temp, sizeof(StackNode));
     s->size--;
     return data;
 }
@@ -101,42 +117,52 @@ int stack_get_size(Stack* s) {
 
 // عقدة مكدس التنفيذ
 struct ExecutionStackNode {
-    ExecutionRecord record;
     ExecutionStackNode* next;
+    ExecutionRecord record;
 };
 
 // هيكل مكدس التنفيذ
 struct ExecutionStack {
     ExecutionStackNode* top;
+    ExecutionStackNode* bottom;
     int size;
+    NodeArena* arena;
+    bool on_default_arena;
 };
 
-// إنشاء مكدس تنفيذ
-ExecutionStack* exec_stack_create() {
+// إنشاء مكدس تنفيذ يأخذ عقده من Arena مشتركة
+ExecutionStack* exec_stack_create_in(NodeArena* arena) {
     ExecutionStack* s = (ExecutionStack*)malloc(sizeof(ExecutionStack));
     s->top = nullptr;
+    s->bottom = nullptr;
     s->size = 0;
+    s->arena = arena;
+    s->on_default_arena = false;
+    return s;
+}
+
+// إنشاء مكدس تنفيذ (على الـ Arena الافتراضية لهذا الـ thread)
+ExecutionStack* exec_stack_create() {
+    ExecutionStack* s = exec_stack_create_in(arena_default());
+    s->on_default_arena = true;
     return s;
 }
 
-// تدمير مكدس التنفيذ
+// تدمير مكدس التنفيذ - O(1) مثل stack_destroy
 void exec_stack_destroy(ExecutionStack* s) {
     if (!s) return;
-    
-    ExecutionStackNode* current = s->top;
-    while (current) {
-        ExecutionStackNode* temp = current;
-        current = current->next;
-        free(temp);
+    if (s->on_default_arena) {
+        arena_free_chain(s->arena, s->top, s->bottom, sizeof(ExecutionStackNode));
     }
     free(s);
 }
 
 // إضافة سجل تنفيذ
 void exec_stack_push(ExecutionStack* s, ExecutionRecord r) {
-    ExecutionStackNode* node = (ExecutionStackNode*)malloc(sizeof(ExecutionStackNode));
+    ExecutionStackNode* node = (ExecutionStackNode*)arena_alloc(s->arena, sizeof(ExecutionStackNode));
     node->record = r;
     node->next = s->top;
+    if (!s->top) s->bottom = node;
     s->top = node;
     s->size++;
 }
@@ -144,14 +170,15 @@ void exec_stack_push(ExecutionStack* s, ExecutionRecord r) {
 // إزالة سجل تنفيذ
 ExecutionRecord exec_stack_pop(ExecutionStack* s) {
     if (s->size == 0) {
-        ExecutionRecord empty = {-1, 0, 0};
+        ExecutionRecord empty = {-1, 0, 0, 0};
         return empty;
     }
     
     ExecutionStackNode* temp = s->top;
     ExecutionRecord record = temp->record;
     s->top = s->top->next;
-    free(temp);
+    if (!s->top) s->bottom = nullptr;
+    arena_free(s->arena, temp, sizeof(ExecutionStackNode));
     s->size--;
     return record;
 }
@@ -3,7 +3,8 @@
  * @brief File and Print Handling
  * 
  * Contains:
- * - Load processes from file
+ * - Load processes from file (text, or a binary .trace via trace_file.cpp)
+ * - Stream processes one at a time (ProcessStream)
  * - Print results
  * - Print Gantt chart
  */
@@ -12,52 +13,251 @@
 #define IO_HANDLER_CPP_INCLUDED
 
 #include "algorithms/algorithms.cpp"
+#include "trace_file.cpp"
+#include <charconv>
 #include <fstream>
 #include <iomanip>
-#include <sstream>
 
 using namespace std;
 
 // ==========================================
-// Load Processes from File
+// Text Workload Parser
 // ==========================================
-int load_processes_from_file(const char* filename, Process processes[]) {
-    ifstream file(filename);
-    if (!file.is_open()) {
-        cout << "Error: Cannot open file " << filename << endl;
-        return -1;
+// One pass over the whole buffer with from_chars, no per-line allocation.
+// Each data line holds id, arrival, burst, priority separated by commas
+// and/or whitespace (both formats are accepted on any line). '#' starts a
+// comment. Before the first process, a lone count line ("8") or a text
+// header ("id,arrival,...") is skipped; elsewhere a malformed line is
+// reported with its number and skipped.
+const int LOAD_MAX_REPORTED_ERRORS = 10;
+const int LOAD_FIELDS = 4;
+
+inline const char* skip_blanks(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+    return p;
+}
+
+// Line-by-line state shared by the whole-buffer parser and ProcessStream
+struct LineParser {
+    const char* filename;
+    ostream* warnings;      // where malformed lines are reported
+    long long line_number;
+    long long errors;
+    bool seen_data;
+};
+
+LineParser line_parser_create(const char* filename, ostream& warnings = cout) {
+    LineParser parser = {filename, &warnings, 0, 0, false};
+    return parser;
+}
+
+// Parse one line [p, eol). Returns true and fills process if it holds one.
+inline bool line_parser_feed(LineParser& parser, const char* p, const char* eol, Process& process) {
+    parser.line_number++;
+    
+    const char* stop = (const char*)memchr(p, '#', eol - p);
+    if (!stop) stop = eol;
+    const char* cursor = skip_blanks(p, stop);
+    if (cursor == stop) return false;
+    
+    int fields[LOAD_FIELDS + 1];
+    int n = 0;
+    while (n <= LOAD_FIELDS) {
+        int value;
+        from_chars_result parsed = from_chars(cursor, stop, value);
+        if (parsed.ec != errc()) break;
+        fields[n++] = value;
+        cursor = skip_blanks(parsed.ptr, stop);
+        if (cursor < stop && *cursor == ',') cursor = skip_blanks(cursor + 1, stop);
+    }
+    
+    if (n == LOAD_FIELDS && cursor == stop) {
+        process = create_process(fields[0], fields[1], fields[2], fields[3]);
+        parser.seen_data = true;
+        return true;
     }
     
-    string line;
-    int count = 0;
+    bool header = !parser.seen_data && ((n == 1 && cursor == stop) || n == 0);
+    parser.seen_data = true;
+    if (header) return false;
+    
+    parser.errors++;
+    if (parser.errors <= LOAD_MAX_REPORTED_ERRORS) {
+        *parser.warnings << "Warning: " << parser.filename << ":" << parser.line_number
+             << ": expected id, arrival, burst, priority - line skipped" << endl;
+    }
+    return false;
+}
+
+void line_parser_finish(const LineParser& parser) {
+    if (parser.errors > LOAD_MAX_REPORTED_ERRORS) {
+        *parser.warnings << "Warning: " << parser.filename << ": " << parser.errors << " malformed lines skipped in total" << endl;
+    }
+}
+
+// Returns a malloc'd array (caller frees) and stores its length in count
+Process* parse_processes_text(const char* data, size_t size, const char* filename, int* count) {
+    const char* p = data;
+    const char* end = data + size;
+    if (size >= 3 && memcmp(p, "\xEF\xBB\xBF", 3) == 0) p += 3;     // UTF-8 BOM
     
-    // Skip header line
-    getline(file, line);
+    // At most one process per line: size the array once instead of regrowing it
+    size_t lines = 1;
+    for (const char* q = p; (q = (const char*)memchr(q, '\n', end - q)) != nullptr; q++) lines++;
+    int capacity = (lines < (size_t)INT_MAX) ? (int)lines : INT_MAX;
+    Process* processes = (Process*)malloc(sizeof(Process) * capacity);
+    *count = 0;
     
-    while (getline(file, line) && count < MAX_PROCESSES) {
-        if (line.empty() || line[0] == '#') continue;
-        
-        stringstream ss(line);
-        int id, arrival, burst, priority;
-        char comma;
-        
-        // Read CSV format
-        if (ss >> id >> comma >> arrival >> comma >> burst >> comma >> priority) {
-            processes[count] = create_process(id, arrival, burst, priority);
-            count++;
-        } else {
-            // Try reading without commas
-            ss.clear();
-            ss.str(line);
-            if (ss >> id >> arrival >> burst >> priority) {
-                processes[count] = create_process(id, arrival, burst, priority);
-                count++;
-            }
+    LineParser parser = line_parser_create(filename);
+    while (p < end) {
+        const char* eol = (const char*)memchr(p, '\n', end - p);
+        if (!eol) eol = end;
+        if (line_parser_feed(parser, p, eol, processes[*count])) {
+            (*count)++;
+            if (*count >= capacity) break;
         }
+        p = eol + 1;
     }
     
-    file.close();
-    return count;
+    line_parser_finish(parser);
+    return processes;
+}
+
+// ==========================================
+// Process Stream
+// ==========================================
+// Yields processes one at a time from stdin or a file, so a workload is
+// never held in memory as a whole. Text is read in fixed chunks with the
+// same line rules as parse_processes_text; a binary trace is mapped and
+// read in place.
+const size_t STREAM_CHUNK_SIZE = 1 << 20;
+
+struct ProcessStream {
+    FILE* file;
+    char* buffer;
+    size_t begin;           // unread data is buffer[begin, end)
+    size_t end;
+    size_t capacity;
+    bool eof;
+    LineParser parser;
+    bool binary;
+    MappedTrace trace;
+    int next;               // next trace row
+};
+
+// filename nullptr or "-" reads stdin. Returns false (with an error
+// printed) if the file cannot be opened. Warnings go to stderr so they
+// do not mix with results written to stdout.
+bool process_stream_open(const char* filename, ProcessStream& stream) {
+    memset(&stream, 0, sizeof(stream));
+    bool from_stdin = !filename || strcmp(filename, "-") == 0;
+    stream.parser = line_parser_create(from_stdin ? "<stdin>" : filename, cerr);
+    
+    if (!from_stdin && trace_is_binary(filename)) {
+        stream.binary = true;
+        return trace_open(filename, stream.trace);
+    }
+    
+    stream.file = from_stdin ? stdin : fopen(filename, "rb");
+    if (!stream.file) {
+        cerr << "Error: Cannot open file " << filename << endl;
+        return false;
+    }
+    stream.capacity = STREAM_CHUNK_SIZE;
+    stream.buffer = (char*)malloc(stream.capacity);
+    return true;
+}
+
+// Read more data after the unread tail. Returns false at end of input.
+bool process_stream_fill(ProcessStream& stream) {
+    if (stream.eof) return false;
+    if (stream.begin > 0) {
+        memmove(stream.buffer, stream.buffer + stream.begin, stream.end - stream.begin);
+        stream.end -= stream.begin;
+        stream.begin = 0;
+    }
+    // A line longer than the buffer: grow it
+    if (stream.end == stream.capacity) {
+        stream.capacity *= 2;
+        stream.buffer = (char*)realloc(stream.buffer, stream.capacity);
+    }
+    
+    bool first = stream.parser.line_number == 0 && stream.end == 0;
+    size_t n = fread(stream.buffer + stream.end, 1, stream.capacity - stream.end, stream.file);
+    if (n == 0) {
+        stream.eof = true;
+        return false;
+    }
+    if (first && n >= 3 && memcmp(stream.buffer, "\xEF\xBB\xBF", 3) == 0) {     // UTF-8 BOM
+        stream.begin = 3;
+    }
+    stream.end += n;
+    return true;
+}
+
+// Next process, or false at end of input
+bool process_stream_next(ProcessStream& stream, Process& process) {
+    if (stream.binary) {
+        if (stream.next >= stream.trace.count) return false;
+        int i = stream.next++;
+        process = create_process(stream.trace.id[i], stream.trace.arrival_time[i],
+                                 stream.trace.burst_time[i], stream.trace.priority[i]);
+        return true;
+    }
+    
+    while (true) {
+        const char* p = stream.buffer + stream.begin;
+        const char* eol = (const char*)memchr(p, '\n', stream.end - stream.begin);
+        if (!eol) {
+            if (process_stream_fill(stream)) continue;
+            if (stream.begin == stream.end) return false;
+            p = stream.buffer + stream.begin;     // last line without a newline
+            eol = stream.buffer + stream.end;
+        }
+        stream.begin = (eol - stream.buffer) + (eol < stream.buffer + stream.end ? 1 : 0);
+        if (line_parser_feed(stream.parser, p, eol, process)) return true;
+    }
+}
+
+void process_stream_close(ProcessStream& stream) {
+    if (stream.binary) {
+        trace_close(stream.trace);
+    } else {
+        line_parser_finish(stream.parser);
+        if (stream.file && stream.file != stdin) fclose(stream.file);
+        free(stream.buffer);
+    }
+    memset(&stream, 0, sizeof(stream));
+}
+
+// ==========================================
+// Load Processes from File
+// ==========================================
+// Returns a malloc'd array (caller frees) and stores its length in count,
+// or returns nullptr and sets count to -1 if the file cannot be opened
+Process* load_processes_from_file(const char* filename, int* count) {
+    // Binary traces are mapped, not parsed
+    if (trace_is_binary(filename)) {
+        MappedTrace trace;
+        if (!trace_open(filename, trace)) {
+            *count = -1;
+            return nullptr;
+        }
+        Process* processes = trace_to_processes(trace);
+        *count = trace.count;
+        trace_close(trace);
+        return processes;
+    }
+    
+    MappedFile file;
+    if (!file_map(filename, file)) {
+        cout << "Error: Cannot open file " << filename << endl;
+        *count = -1;
+        return nullptr;
+    }
+    Process* processes = parse_processes_text(file.data, file.size, filename, count);
+    file_unmap(file);
+    return processes;
 }
 
 // ==========================================
@@ -107,34 +307,51 @@ void print_result(const SchedulingResult& result) {
     cout << "Average Waiting Time: " << result.avg_waiting_time << endl;
     cout << "Average Turnaround Time: " << result.avg_turnaround_time << endl;
     cout << "CPU Utilization: " << result.cpu_utilization << "%" << endl;
+    
+    if (result.cpu_count > 1 && result.cpu_utilizations) {
+        cout << "Load Imbalance: " << result.load_imbalance << "%" << endl;
+        for (int cpu = 0; cpu < result.cpu_count; cpu++) {
+            cout << "  CPU " << setw(3) << cpu << ": " << result.cpu_utilizations[cpu] << "%" << endl;
+        }
+    }
 }
 
 // ==========================================
 // Print Gantt Chart
 // ==========================================
-void print_gantt_chart(const SchedulingResult& result) {
-    cout << "\n--- Gantt Chart ---" << endl;
+const int GANTT_MAX_CELL_WIDTH = 60;
+
+// Cell width for one timeline record (3 chars per time unit, capped so
+// long coalesced slices do not flood the terminal)
+int gantt_cell_width(const ExecutionRecord& record) {
+    int width = (record.end_time - record.start_time) * 3;
+    if (width > GANTT_MAX_CELL_WIDTH || width < 0) width = GANTT_MAX_CELL_WIDTH;
+    return width;
+}
+
+// One chart row set (borders, names, time markers) for a run of records
+void print_gantt_rows(const ExecutionRecord records[], int count) {
+    if (count == 0) return;
     
     // Top line
     cout << "+";
-    for (int i = 0; i < result.timeline_length; i++) {
-        int duration = result.timeline[i].end_time - result.timeline[i].start_time;
-        for (int j = 0; j < duration * 3; j++) cout << "-";
+    for (int i = 0; i < count; i++) {
+        int width = gantt_cell_width(records[i]);
+        for (int j = 0; j < width; j++) cout << "-";
         cout << "+";
     }
     cout << endl;
     
     // Process names
     cout << "|";
-    for (int i = 0; i < result.timeline_length; i++) {
-        int duration = result.timeline[i].end_time - result.timeline[i].start_time;
-        int spaces = duration * 3;
+    for (int i = 0; i < count; i++) {
+        int spaces = gantt_cell_width(records[i]);
         int id_len = 2; // P + digit
         int left_pad = (spaces - id_len) / 2;
         int right_pad = spaces - id_len - left_pad;
         
         for (int j = 0; j < left_pad; j++) cout << " ";
-        cout << "P" << result.timeline[i].process_id;
+        cout << "P" << records[i].process_id;
         for (int j = 0; j < right_pad; j++) cout << " ";
         cout << "|";
     }
@@ -142,23 +359,62 @@ void print_gantt_chart(const SchedulingResult& result) {
     
     // Bottom line
     cout << "+";
-    for (int i = 0; i < result.timeline_length; i++) {
-        int duration = result.timeline[i].end_time - result.timeline[i].start_time;
-        for (int j = 0; j < duration * 3; j++) cout << "-";
+    for (int i = 0; i < count; i++) {
+        int width = gantt_cell_width(records[i]);
+        for (int j = 0; j < width; j++) cout << "-";
         cout << "+";
     }
     cout << endl;
     
     // Time markers
-    cout << result.timeline[0].start_time;
-    for (int i = 0; i < result.timeline_length; i++) {
-        int duration = result.timeline[i].end_time - result.timeline[i].start_time;
-        for (int j = 0; j < duration * 3; j++) cout << " ";
-        cout << result.timeline[i].end_time;
+    cout << records[0].start_time;
+    for (int i = 0; i < count; i++) {
+        int width = gantt_cell_width(records[i]);
+        for (int j = 0; j < width; j++) cout << " ";
+        cout << records[i].end_time;
     }
     cout << endl;
 }
 
+void print_gantt_chart(const SchedulingResult& result) {
+    cout << "\n--- Gantt Chart ---" << endl;
+    if (result.cpu_count <= 1) {
+        print_gantt_rows(result.timeline, result.timeline_length);
+        return;
+    }
+    
+    // One chart per CPU
+    ExecutionRecord* records = (ExecutionRecord*)malloc(sizeof(ExecutionRecord) * (result.timeline_length + 1));
+    for (int cpu = 0; cpu < result.cpu_count; cpu++) {
+        int count = 0;
+        for (int i = 0; i < result.timeline_length; i++) {
+            if (result.timeline[i].cpu_id == cpu) records[count++] = result.timeline[i];
+        }
+        cout << "CPU " << cpu << ":" << endl;
+        print_gantt_rows(records, count);
+    }
+    free(records);
+}
+
+// ==========================================
+// Print Work Stealing Report
+// ==========================================
+void print_work_stealing_report(const WorkStealingReport& report) {
+    cout << "\n--- Work Stealing vs Global Queue (" << report.cpu_count << " CPUs) ---" << endl;
+    cout << "+------------------+----------------+----------------+" << endl;
+    cout << "|                  | Work Stealing  | Global Queue   |" << endl;
+    cout << "+------------------+----------------+----------------+" << endl;
+    cout << "| Makespan         | " << setw(14) << report.makespan << " | "
+         << setw(14) << report.global_makespan << " |" << endl;
+    cout << "| Migrations       | " << setw(14) << report.migrations << " | "
+         << setw(14) << report.global_migrations << " |" << endl;
+    cout << "| Steals           | " << setw(14) << report.steals << " | "
+         << setw(14) << "-" << " |" << endl;
+    cout << "+------------------+----------------+----------------+" << endl;
+    cout << fixed << setprecision(2);
+    cout << "Makespan Improvement: " << report.makespan_improvement << "%" << endl;
+}
+
 // ==========================================
 // Print Menu
 // ==========================================
@@ -203,12 +459,20 @@ bool save_result_to_file(const SchedulingResult& result, const char* filename) {
     file << "Avg Waiting Time: " << result.avg_waiting_time << endl;
     file << "Avg Turnaround Time: " << result.avg_turnaround_time << endl;
     file << "CPU Utilization: " << result.cpu_utilization << "%" << endl;
+    if (result.cpu_count > 1 && result.cpu_utilizations) {
+        file << "Load Imbalance: " << result.load_imbalance << "%" << endl;
+        for (int cpu = 0; cpu < result.cpu_count; cpu++) {
+            file << "CPU " << cpu << " Utilization: " << result.cpu_utilizations[cpu] << "%" << endl;
+        }
+    }
     
     file << "\nTimeline:" << endl;
     for (int i = 0; i < result.timeline_length; i++) {
         file << "P" << result.timeline[i].process_id << " ["
              << result.timeline[i].start_time << "-"
-             << result.timeline[i].end_time << "]" << endl;
+             << result.timeline[i].end_time << "]";
+        if (result.cpu_count > 1) file << " CPU " << result.timeline[i].cpu_id;
+        file << endl;
     }
     
     file.close();
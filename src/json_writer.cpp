@@ -0,0 +1,119 @@
+/**
+ * @file json_writer.cpp
+ * @brief كاتب JSON متدفق بمخزن مؤقت ثابت
+ *
+ * يكتب مباشرة إلى FILE* (أو يُلحق بـ string) عبر مخزن بحجم ثابت،
+ * فلا يُبنى المستند كاملاً في الذاكرة. الأعداد تُحول بـ to_chars:
+ * - الصحيحة كما هي
+ * - العشرية بدقة 6 أرقام معنوية (مثل %g)، وهو نفس تنسيق ostream الافتراضي
+ *   فالمخرجات مطابقة حرفياً لما كان يكتبه stringstream
+ *
+ * compact: حذف فواصل الأسطر ليصبح كل مستند سطراً واحداً (وضع --serve)
+ */
+
+#ifndef JSON_WRITER_CPP_INCLUDED
+#define JSON_WRITER_CPP_INCLUDED
+
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace std;
+
+const size_t JSON_WRITER_BUFFER_SIZE = 64 * 1024;
+const int JSON_DOUBLE_PRECISION = 6;
+
+struct JsonWriter {
+    char* buffer;
+    size_t length;
+    FILE* file;             // الوجهة، أو nullptr للإلحاق بـ text
+    string* text;
+    bool compact;
+};
+
+JsonWriter json_writer_to_file(FILE* file, bool compact = false) {
+    JsonWriter writer;
+    writer.buffer = (char*)malloc(JSON_WRITER_BUFFER_SIZE);
+    writer.length = 0;
+    writer.file = file;
+    writer.text = nullptr;
+    writer.compact = compact;
+    return writer;
+}
+
+JsonWriter json_writer_to_string(string* text, bool compact = false) {
+    JsonWriter writer = json_writer_to_file(nullptr, compact);
+    writer.text = text;
+    return writer;
+}
+
+// نقل محتوى المخزن إلى الوجهة (دون fflush للملف)
+void json_flush(JsonWriter& writer) {
+    if (writer.length == 0) return;
+    if (writer.file) {
+        fwrite(writer.buffer, 1, writer.length, writer.file);
+    } else {
+        writer.text->append(writer.buffer, writer.length);
+    }
+    writer.length = 0;
+}
+
+void json_writer_destroy(JsonWriter& writer) {
+    json_flush(writer);
+    free(writer.buffer);
+    writer.buffer = nullptr;
+}
+
+// ضمان مساحة n حرف في المخزن (n أصغر من حجم المخزن)
+inline char* json_reserve(JsonWriter& writer, size_t n) {
+    if (writer.length + n > JSON_WRITER_BUFFER_SIZE) {
+        json_flush(writer);
+    }
+    return writer.buffer + writer.length;
+}
+
+// ==========================================
+// الكتابة
+// ==========================================
+void json_raw(JsonWriter& writer, const char* data, size_t n) {
+    while (n > 0) {
+        size_t chunk = (n < JSON_WRITER_BUFFER_SIZE) ? n : JSON_WRITER_BUFFER_SIZE;
+        memcpy(json_reserve(writer, chunk), data, chunk);
+        writer.length += chunk;
+        data += chunk;
+        n -= chunk;
+    }
+}
+
+inline void json_text(JsonWriter& writer, const char* text) {
+    json_raw(writer, text, strlen(text));
+}
+
+// نص ثابت (طوله معروف وقت الترجمة)
+template <size_t N>
+inline void json_literal(JsonWriter& writer, const char (&text)[N]) {
+    json_raw(writer, text, N - 1);
+}
+
+inline void json_char(JsonWriter& writer, char c) {
+    *json_reserve(writer, 1) = c;
+    writer.length++;
+}
+
+// نهاية سطر (لا شيء في الوضع المضغوط)
+inline void json_newline(JsonWriter& writer) {
+    if (!writer.compact) json_char(writer, '\n');
+}
+
+inline void json_int(JsonWriter& writer, long long value) {
+    char* at = json_reserve(writer, 24);
+    writer.length = to_chars(at, at + 24, value).ptr - writer.buffer;
+}
+
+inline void json_double(JsonWriter& writer, double value) {
+    char* at = json_reserve(writer, 32);
+    writer.length = to_chars(at, at + 32, value, chars_format::general, JSON_DOUBLE_PRECISION).ptr - writer.buffer;
+}
+
+#endif // JSON_WRITER_CPP_INCLUDED
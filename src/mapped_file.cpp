@@ -0,0 +1,91 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Read-only view of a whole file (mmap, or a plain read on Windows)
+ */
+
+#ifndef MAPPED_FILE_CPP_INCLUDED
+#define MAPPED_FILE_CPP_INCLUDED
+
+#include <cstdio>
+#include <cstdlib>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+struct MappedFile {
+    const char* data;
+    size_t size;
+    void* base;             // mapping (or malloc'd copy on Windows), nullptr if empty
+};
+
+// Map the whole file. Returns false if it cannot be opened or read.
+// An empty file maps successfully with size 0.
+bool file_map(const char* filename, MappedFile& file, bool sequential = true) {
+    file.data = "";
+    file.size = 0;
+    file.base = nullptr;
+
+#ifdef _WIN32
+    (void)sequential;
+    FILE* handle = fopen(filename, "rb");
+    if (!handle) return false;
+    fseek(handle, 0, SEEK_END);
+    long size = ftell(handle);
+    fseek(handle, 0, SEEK_SET);
+    if (size > 0) {
+        file.base = malloc((size_t)size);
+        if (fread(file.base, 1, (size_t)size, handle) != (size_t)size) {
+            free(file.base);
+            file.base = nullptr;
+            fclose(handle);
+            return false;
+        }
+        file.data = (const char*)file.base;
+        file.size = (size_t)size;
+    }
+    fclose(handle);
+    return true;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) < 0) {
+        close(fd);
+        return false;
+    }
+    if (info.st_size > 0) {
+        void* base = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (base == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        if (sequential) madvise(base, (size_t)info.st_size, MADV_SEQUENTIAL);
+        file.base = base;
+        file.data = (const char*)base;
+        file.size = (size_t)info.st_size;
+    }
+    close(fd);
+    return true;
+#endif
+}
+
+void file_unmap(MappedFile& file) {
+    if (file.base) {
+#ifdef _WIN32
+        free(file.base);
+#else
+        munmap(file.base, file.size);
+#endif
+    }
+    file.data = "";
+    file.size = 0;
+    file.base = nullptr;
+}
+
+#endif // MAPPED_FILE_CPP_INCLUDED
@@ -0,0 +1,269 @@
+/**
+ * @file result_cache.cpp
+ * @brief ذاكرة مؤقتة للنتائج (LRU) داخل العملية
+ *
+ * المفتاح: بصمة 128 بت لجدول العمليات (id, arrival, burst, priority لكل
+ * عملية بالترتيب) مع عدد العمليات ورقم الخوارزمية والـ quantum وإعداد
+ * المعالجات. الطلب المتكرر لنفس الحمل يعيد نسخة من النتيجة المحفوظة
+ * دون أي محاكاة، وتكلفته حساب البصمة (خطي وسريع) ونسخ النتيجة.
+ *
+ * الحجم محدود بعدد البايتات: عند تجاوزه تُحذف النتيجة الأقدم استخداماً.
+ * مشتركة بين كل الجلسات والـ threads (محمية بـ mutex).
+ */
+
+#ifndef RESULT_CACHE_CPP_INCLUDED
+#define RESULT_CACHE_CPP_INCLUDED
+
+#include "types.cpp"
+#include <cstdint>
+#include <mutex>
+
+using namespace std;
+
+const size_t RESULT_CACHE_DEFAULT_LIMIT = 64 * 1024 * 1024;
+
+struct ResultCacheKey {
+    uint64_t hash[2];           // مساران مستقلان: احتمال التصادم مهمل
+    int process_count;
+    int algorithm_id;
+    int time_quantum;           // 0 لغير Round Robin (لا يؤثر في النتيجة)
+    int cpu_count;
+    int queue_mode;             // 0 لمعالج واحد
+};
+
+// كل نتيجة في عقدة مستقلة، مربوطة في سلسلة الـ bucket الخاص بمفتاحها
+// وفي قائمة LRU مزدوجة (الأحدث استخداماً في الرأس، الأقدم في الذيل)
+struct ResultCacheEntry {
+    ResultCacheKey key;
+    SchedulingResult result;
+    size_t bytes;
+    ResultCacheEntry* bucket_next;
+    ResultCacheEntry* lru_prev;
+    ResultCacheEntry* lru_next;
+};
+
+struct ResultCacheStats {
+    long long hits;
+    long long misses;
+    long long evictions;
+    int entries;
+    size_t bytes;
+    size_t limit_bytes;
+};
+
+// جدول hash بالتسلسل (البحث O(1)) مع قائمة LRU (الحذف من الذيل O(1))
+struct ResultCache {
+    ResultCacheEntry** buckets = nullptr;
+    int bucket_count = 0;           // قوة للعدد 2، ويتضاعف عندما يصل إليه count
+    int count = 0;
+    ResultCacheEntry* lru_head = nullptr;
+    ResultCacheEntry* lru_tail = nullptr;
+    size_t bytes = 0;
+    size_t limit_bytes = RESULT_CACHE_DEFAULT_LIMIT;
+    long long hits = 0;
+    long long misses = 0;
+    long long evictions = 0;
+    mutex lock;
+};
+
+ResultCache result_cache;
+
+// ==========================================
+// المفتاح
+// ==========================================
+inline uint64_t cache_mix(uint64_t h, uint64_t value, uint64_t multiplier) {
+    h ^= value * multiplier;
+    h ^= h >> 29;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    return h ^ (h >> 32);
+}
+
+ResultCacheKey result_cache_key(const Process processes[], int count, int algorithm_id,
+                                int time_quantum, int cpu_count, int queue_mode) {
+    uint64_t a = 0x243F6A8885A308D3ULL;
+    uint64_t b = 0x13198A2E03707344ULL;
+    for (int i = 0; i < count; i++) {
+        const Process& p = processes[i];
+        uint64_t first = (uint32_t)p.id | ((uint64_t)(uint32_t)p.arrival_time << 32);
+        uint64_t second = (uint32_t)p.burst_time | ((uint64_t)(uint32_t)p.priority << 32);
+        a = cache_mix(cache_mix(a, first, 0x9E3779B97F4A7C15ULL), second, 0x9E3779B97F4A7C15ULL);
+        b = cache_mix(cache_mix(b, first, 0xC2B2AE3D27D4EB4FULL), second, 0xC2B2AE3D27D4EB4FULL);
+    }
+
+    ResultCacheKey key;
+    key.hash[0] = a;
+    key.hash[1] = b;
+    key.process_count = count;
+    key.algorithm_id = algorithm_id;
+    key.time_quantum = (algorithm_id == 6) ? time_quantum : 0;
+    key.cpu_count = (cpu_count > 1) ? cpu_count : 1;
+    key.queue_mode = (cpu_count > 1) ? queue_mode : 0;
+    return key;
+}
+
+inline bool cache_key_equal(const ResultCacheKey& x, const ResultCacheKey& y) {
+    return x.hash[0] == y.hash[0] && x.hash[1] == y.hash[1] && x.process_count == y.process_count &&
+           x.algorithm_id == y.algorithm_id && x.time_quantum == y.time_quantum &&
+           x.cpu_count == y.cpu_count && x.queue_mode == y.queue_mode;
+}
+
+// ==========================================
+// دوال مساعدة (يستدعيها من يملك القفل)
+// ==========================================
+size_t cache_result_bytes(const SchedulingResult& result) {
+    size_t bytes = sizeof(ResultCacheEntry);
+    bytes += sizeof(Process) * result.process_count;
+    bytes += sizeof(ExecutionRecord) * result.timeline_length;
+    if (result.cpu_utilizations) bytes += sizeof(double) * result.cpu_count;
+    return bytes;
+}
+
+// key.hash[0] موزع بانتظام، فبتاته الدنيا تكفي لاختيار الـ bucket
+inline ResultCacheEntry** cache_bucket(const ResultCacheKey& key) {
+    return &result_cache.buckets[key.hash[0] & (uint64_t)(result_cache.bucket_count - 1)];
+}
+
+ResultCacheEntry* cache_find(const ResultCacheKey& key) {
+    if (result_cache.bucket_count == 0) return nullptr;
+    for (ResultCacheEntry* entry = *cache_bucket(key); entry; entry = entry->bucket_next) {
+        if (cache_key_equal(entry->key, key)) return entry;
+    }
+    return nullptr;
+}
+
+// مضاعفة عدد الـ buckets وإعادة توزيع العقد
+void cache_grow_buckets() {
+    ResultCache& cache = result_cache;
+    ResultCacheEntry** old_buckets = cache.buckets;
+    int old_count = cache.bucket_count;
+    cache.bucket_count = (old_count > 0) ? old_count * 2 : 16;
+    cache.buckets = (ResultCacheEntry**)calloc(cache.bucket_count, sizeof(ResultCacheEntry*));
+    for (int b = 0; b < old_count; b++) {
+        ResultCacheEntry* entry = old_buckets[b];
+        while (entry) {
+            ResultCacheEntry* next = entry->bucket_next;
+            ResultCacheEntry** bucket = cache_bucket(entry->key);
+            entry->bucket_next = *bucket;
+            *bucket = entry;
+            entry = next;
+        }
+    }
+    free(old_buckets);
+}
+
+void cache_lru_unlink(ResultCacheEntry* entry) {
+    ResultCache& cache = result_cache;
+    if (entry->lru_prev) entry->lru_prev->lru_next = entry->lru_next;
+    else cache.lru_head = entry->lru_next;
+    if (entry->lru_next) entry->lru_next->lru_prev = entry->lru_prev;
+    else cache.lru_tail = entry->lru_prev;
+}
+
+void cache_lru_push_front(ResultCacheEntry* entry) {
+    ResultCache& cache = result_cache;
+    entry->lru_prev = nullptr;
+    entry->lru_next = cache.lru_head;
+    if (cache.lru_head) cache.lru_head->lru_prev = entry;
+    else cache.lru_tail = entry;
+    cache.lru_head = entry;
+}
+
+void cache_remove(ResultCacheEntry* entry) {
+    ResultCache& cache = result_cache;
+    ResultCacheEntry** link = cache_bucket(entry->key);
+    while (*link != entry) {
+        link = &(*link)->bucket_next;
+    }
+    *link = entry->bucket_next;
+    cache_lru_unlink(entry);
+
+    cache.bytes -= entry->bytes;
+    cache.count--;
+    result_destroy(entry->result);
+    free(entry);
+}
+
+// حذف الأقدم استخداماً (ذيل القائمة) حتى تتسع الذاكرة لـ incoming بايت إضافية
+void cache_evict_for(size_t incoming) {
+    ResultCache& cache = result_cache;
+    while (cache.lru_tail && cache.bytes + incoming > cache.limit_bytes) {
+        cache_remove(cache.lru_tail);
+        cache.evictions++;
+    }
+}
+
+// ==========================================
+// الواجهة
+// ==========================================
+
+// عند وجود المفتاح: نسخة من النتيجة في result (يحررها المستدعي) وتعيد true
+bool result_cache_lookup(const ResultCacheKey& key, SchedulingResult& result) {
+    lock_guard<mutex> guard(result_cache.lock);
+    ResultCacheEntry* entry = cache_find(key);
+    if (!entry) {
+        result_cache.misses++;
+        return false;
+    }
+    result_cache.hits++;
+    cache_lru_unlink(entry);
+    cache_lru_push_front(entry);
+    result = result_clone(entry->result);
+    return true;
+}
+
+// حفظ نسخة من result. النتيجة الأكبر من الحد كله لا تُحفظ
+void result_cache_insert(const ResultCacheKey& key, const SchedulingResult& result) {
+    size_t bytes = cache_result_bytes(result);
+    lock_guard<mutex> guard(result_cache.lock);
+    ResultCache& cache = result_cache;
+    if (bytes > cache.limit_bytes || cache_find(key)) {
+        return;
+    }
+    cache_evict_for(bytes);
+
+    if (cache.count >= cache.bucket_count) {
+        cache_grow_buckets();
+    }
+    ResultCacheEntry* entry = (ResultCacheEntry*)malloc(sizeof(ResultCacheEntry));
+    entry->key = key;
+    entry->result = result_clone(result);
+    entry->bytes = bytes;
+    ResultCacheEntry** bucket = cache_bucket(key);
+    entry->bucket_next = *bucket;
+    *bucket = entry;
+    cache_lru_push_front(entry);
+    cache.count++;
+    cache.bytes += bytes;
+}
+
+// حد الذاكرة بالبايت (0 يعطل الـ cache)، مع حذف ما يزيد عنه فوراً
+void result_cache_set_limit(size_t limit_bytes) {
+    lock_guard<mutex> guard(result_cache.lock);
+    result_cache.limit_bytes = limit_bytes;
+    cache_evict_for(0);
+}
+
+// حذف كل النتائج وتصفير العدادات
+void result_cache_clear() {
+    lock_guard<mutex> guard(result_cache.lock);
+    while (result_cache.lru_head) {
+        cache_remove(result_cache.lru_head);
+    }
+    result_cache.hits = 0;
+    result_cache.misses = 0;
+    result_cache.evictions = 0;
+}
+
+ResultCacheStats result_cache_get_stats() {
+    lock_guard<mutex> guard(result_cache.lock);
+    ResultCacheStats stats;
+    stats.hits = result_cache.hits;
+    stats.misses = result_cache.misses;
+    stats.evictions = result_cache.evictions;
+    stats.entries = result_cache.count;
+    stats.bytes = result_cache.bytes;
+    stats.limit_bytes = result_cache.limit_bytes;
+    return stats;
+}
+
+#endif // RESULT_CACHE_CPP_INCLUDED
@@ -0,0 +1,271 @@
+/**
+ * @file server.cpp
+ * @brief وضع الخادم: البرنامج يبقى يعمل ويجيب طلبات متتالية
+ *
+ * كل طلب سطر واحد:
+ *     <algo> <quantum> <count> <a1 b1 p1> <a2 b2 p2> ...
+ * حيث algo من 1 إلى 6 أو all. الرد سطر واحد: نفس JSON وضع --json
+ * بدون فواصل الأسطر، أو {"error": "..."} إذا كان الطلب غير صحيح.
+ * الطلب cache وحده يعيد عدادات الـ cache المشترك (result_cache.cpp).
+ *
+ * الطلبات تُقرأ وتُنفذ بالترتيب، فيمكن للعميل إرسال عدة طلبات
+ * دون انتظار الردود (pipelining) ثم قراءة الردود بنفس الترتيب.
+ *
+ * المصدر stdin/stdout، أو Unix socket: عدد ثابت من الـ threads يستقبل كل
+ * منها اتصالاً واحداً في كل مرة بجلسته الخاصة، والاتصالات الزائدة تنتظر
+ * في طابور listen حتى يتفرغ أحدها
+ *
+ * الجلسة في الوضع التدريجي: الطلبات المتتالية من الواجهة تختلف عادة في
+ * عملية واحدة، فتُستأنف المحاكاة من آخر نقطة قبل التغيير
+ */
+
+#ifndef SERVER_CPP_INCLUDED
+#define SERVER_CPP_INCLUDED
+
+#include "api.cpp"
+#include <cstdio>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// عدد الاتصالات التي تُخدم معاً على الـ socket
+const int SERVE_MAX_CONNECTIONS = 16;
+
+struct ServeOptions {
+    int cpu_count;
+    SmpQueueMode queue_mode;
+};
+
+// ==========================================
+// قراءة سطر
+// ==========================================
+// يقرأ سطراً كاملاً (مهما طال) إلى line التي تكبر حسب الحاجة
+// يعيد false عند نهاية الإدخال دون أي حرف
+bool serve_read_line(FILE* in, char*& line, size_t& capacity) {
+    size_t length = 0;
+    while (true) {
+        if (capacity - length < 2) {
+            capacity = (capacity > 0) ? capacity * 2 : 4096;
+            line = (char*)realloc(line, capacity);
+        }
+        if (!fgets(line + length, (int)(capacity - length), in)) {
+            return length > 0;
+        }
+        length += strlen(line + length);
+        if (line[length - 1] == '\n') {
+            line[length - 1] = '\0';
+            return true;
+        }
+    }
+}
+
+void serve_write_error(JsonWriter& out, const char* message) {
+    json_literal(out, "{\"error\": \"");
+    json_text(out, message);
+    json_literal(out, "\"}\n");
+}
+
+void serve_write_cache_stats(JsonWriter& out) {
+    ResultCacheStats stats = api_get_cache_stats();
+    json_literal(out, "{\"hits\": "); json_int(out, stats.hits);
+    json_literal(out, ", \"misses\": "); json_int(out, stats.misses);
+    json_literal(out, ", \"evictions\": "); json_int(out, stats.evictions);
+    json_literal(out, ", \"entries\": "); json_int(out, stats.entries);
+    json_literal(out, ", \"bytes\": "); json_int(out, (long long)stats.bytes);
+    json_literal(out, ", \"limit_bytes\": "); json_int(out, (long long)stats.limit_bytes);
+    json_literal(out, "}\n");
+}
+
+// ==========================================
+// تنفيذ طلب
+// ==========================================
+// out في الوضع المضغوط: كل رد سطر واحد
+void serve_request(SchedulerSession* session, char* line, JsonWriter& out, const ServeOptions& options) {
+    char* cursor = line;
+    while (*cursor == ' ' || *cursor == '\t' || *cursor == '\r') cursor++;
+
+    if (strncmp(cursor, "cache", 5) == 0) {
+        serve_write_cache_stats(out);
+        return;
+    }
+    
+    bool run_all = strncmp(cursor, "all", 3) == 0;
+    long algo = 0;
+    char* end;
+    if (run_all) {
+        cursor += 3;
+    } else {
+        algo = strtol(cursor, &end, 10);
+        if (end == cursor || algo < 1 || algo > 6) {
+            serve_write_error(out, "algorithm must be 1-6 or all");
+            return;
+        }
+        cursor = end;
+    }
+
+    long quantum = strtol(cursor, &end, 10);
+    if (end == cursor || quantum < 1) {
+        serve_write_error(out, "invalid quantum");
+        return;
+    }
+    cursor = end;
+
+    long count = strtol(cursor, &end, 10);
+    if (end == cursor || count < 1) {
+        serve_write_error(out, "invalid process count");
+        return;
+    }
+    cursor = end;
+
+    session_reset(session);
+    for (long i = 0; i < count; i++) {
+        long values[3];
+        for (int k = 0; k < 3; k++) {
+            values[k] = strtol(cursor, &end, 10);
+            if (end == cursor) {
+                serve_write_error(out, "expected arrival burst priority for every process");
+                return;
+            }
+            cursor = end;
+        }
+        session_add_process(session, (int)i + 1, (int)values[0], (int)values[1], (int)values[2]);
+    }
+
+    if (run_all) {
+        SchedulingResult results[API_ALGORITHM_COUNT];
+        session_run_all_parallel(session, results, (int)quantum, options.cpu_count, options.queue_mode);
+        json_char(out, '[');
+        for (int t = 0; t < API_ALGORITHM_COUNT; t++) {
+            write_result_json(out, results[t]);
+            if (t < API_ALGORITHM_COUNT - 1) json_char(out, ',');
+            result_destroy(results[t]);
+        }
+        json_literal(out, "]\n");
+    } else {
+        session_run(session, (int)algo, (int)quantum, options.cpu_count, options.queue_mode);
+        session_write_result_json(session, out);
+        json_char(out, '\n');
+    }
+}
+
+// ==========================================
+// خدمة مصدر واحد حتى نهايته
+// ==========================================
+// تتوقف أيضاً عند فشل الكتابة (العميل أغلق الاتصال)
+void serve_stream(FILE* in, FILE* out, const ServeOptions& options) {
+    SchedulerSession* session = session_create();
+    session_set_incremental(session, true);
+    JsonWriter writer = json_writer_to_file(out, true);
+    char* line = nullptr;
+    size_t capacity = 0;
+
+    while (serve_read_line(in, line, capacity)) {
+        // تجاهل الأسطر الفارغة
+        char* cursor = line;
+        while (*cursor == ' ' || *cursor == '\t' || *cursor == '\r') cursor++;
+        if (*cursor == '\0') continue;
+
+        serve_request(session, cursor, writer, options);
+        json_flush(writer);
+        if (fflush(out) != 0 || ferror(out)) {
+            break;
+        }
+    }
+
+    json_writer_destroy(writer);
+    free(line);
+    session_destroy(session);
+}
+
+// ==========================================
+// Unix socket
+// ==========================================
+#ifndef _WIN32
+// thread في مجموعة الخدمة: يستقبل اتصالاً ويخدمه حتى يُغلق، ثم التالي
+// أخطاء accept العابرة تُعاد فوراً، ونفاد الملفات يُنتظر قليلاً قبل الإعادة،
+// وأي خطأ آخر (مثل إغلاق الـ listener) ينهي الـ thread بدل الدوران عليه
+void serve_socket_worker(int listener, ServeOptions options) {
+    while (true) {
+        int connection = accept(listener, nullptr, nullptr);
+        if (connection < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS || errno == ENOMEM) {
+                this_thread::sleep_for(chrono::milliseconds(100));
+                continue;
+            }
+            cerr << "Error: accept failed: " << strerror(errno) << endl;
+            return;
+        }
+
+        FILE* in = fdopen(connection, "r");
+        FILE* out = fdopen(dup(connection), "w");
+        if (in && out) {
+            serve_stream(in, out, options);
+        }
+        if (out) fclose(out);
+        if (in) fclose(in); else close(connection);
+    }
+}
+#endif
+
+// يخدم الاتصالات دون توقف. يعيد false إذا تعذر إنشاء الـ socket، أو إذا
+// توقفت كل الـ threads بسبب خطأ دائم في accept
+bool serve_unix_socket(const char* path, const ServeOptions& options) {
+#ifdef _WIN32
+    (void)path;
+    (void)options;
+    cerr << "Error: --socket is not supported on Windows" << endl;
+    return false;
+#else
+    // حذف socket قديم بنفس المسار فقط، لا أي ملف آخر
+    struct stat existing;
+    if (lstat(path, &existing) == 0) {
+        if (!S_ISSOCK(existing.st_mode)) {
+            cerr << "Error: " << path << " exists and is not a socket" << endl;
+            return false;
+        }
+        unlink(path);
+    }
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0) {
+        cerr << "Error: Cannot create socket" << endl;
+        return false;
+    }
+
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+
+    if (bind(listener, (sockaddr*)&address, sizeof(address)) < 0 || listen(listener, SOMAXCONN) < 0) {
+        cerr << "Error: Cannot listen on " << path << endl;
+        close(listener);
+        return false;
+    }
+
+    // الكتابة إلى عميل أغلق اتصاله تعيد خطأ بدلاً من إنهاء الخادم
+    signal(SIGPIPE, SIG_IGN);
+
+    thread workers[SERVE_MAX_CONNECTIONS];
+    for (int t = 0; t < SERVE_MAX_CONNECTIONS; t++) {
+        workers[t] = thread(serve_socket_worker, listener, options);
+    }
+    for (int t = 0; t < SERVE_MAX_CONNECTIONS; t++) {
+        workers[t].join();
+    }
+    close(listener);
+    return false;
+#endif
+}
+
+#endif // SERVER_CPP_INCLUDED
@@ -0,0 +1,100 @@
+/**
+ * @file stream.cpp
+ * @brief وضع التدفق: جدولة أثر وصول بطول غير محدود دون تحميله في الذاكرة
+ *
+ * العمليات تُقرأ واحدة واحدة (ProcessStream) وتُسلّم إلى OnlineScheduler،
+ * والنتائج تُكتب فور معرفتها، سطر JSON لكل حدث:
+ *     {"event": "segment", "process_id": 1, "start": 0, "end": 5}
+ *     {"event": "complete", "id": 1, "arrival": 0, "burst": 5, ...}
+ * وفي النهاية سطر واحد بالإحصائيات:
+ *     {"event": "summary", "algorithm": "...", "processes": N, ...}
+ *
+ * الإدخال بنفس صيغة ملفات العمليات (نصي أو .trace) ومرتب حسب الوصول
+ */
+
+#ifndef STREAM_CPP_INCLUDED
+#define STREAM_CPP_INCLUDED
+
+#include "api.cpp"
+
+using namespace std;
+
+// ==========================================
+// كتابة الأحداث
+// ==========================================
+void stream_write_segment(const ExecutionRecord& record, void* context) {
+    JsonWriter& w = *(JsonWriter*)context;
+    json_literal(w, "{\"event\": \"segment\", \"process_id\": "); json_int(w, record.process_id);
+    json_literal(w, ", \"start\": "); json_int(w, record.start_time);
+    json_literal(w, ", \"end\": "); json_int(w, record.end_time);
+    json_literal(w, "}\n");
+}
+
+void stream_write_complete(const Process& p, void* context) {
+    JsonWriter& w = *(JsonWriter*)context;
+    json_literal(w, "{\"event\": \"complete\", \"id\": "); json_int(w, p.id);
+    json_literal(w, ", \"arrival\": "); json_int(w, p.arrival_time);
+    json_literal(w, ", \"burst\": "); json_int(w, p.burst_time);
+    json_literal(w, ", \"priority\": "); json_int(w, p.priority);
+    json_literal(w, ", \"start\": "); json_int(w, p.start_time);
+    json_literal(w, ", \"completion\": "); json_int(w, p.completion_time);
+    json_literal(w, ", \"waiting\": "); json_int(w, p.waiting_time);
+    json_literal(w, ", \"turnaround\": "); json_int(w, p.turnaround_time);
+    json_literal(w, "}\n");
+}
+
+void stream_write_summary(JsonWriter& w, const OnlineScheduler* scheduler) {
+    OnlineStats stats = online_get_stats(scheduler);
+    json_literal(w, "{\"event\": \"summary\", \"algorithm\": \""); json_text(w, online_algorithm_name(scheduler));
+    json_literal(w, "\", \"processes\": "); json_int(w, stats.completed);
+    json_literal(w, ", \"avg_waiting_time\": "); json_double(w, stats.avg_waiting_time);
+    json_literal(w, ", \"avg_turnaround_time\": "); json_double(w, stats.avg_turnaround_time);
+    json_literal(w, ", \"cpu_utilization\": "); json_double(w, stats.cpu_utilization);
+    json_literal(w, ", \"peak_live\": "); json_int(w, stats.peak_live);
+    json_literal(w, "}\n");
+}
+
+// ==========================================
+// تشغيل التدفق
+// ==========================================
+// filename nullptr أو "-" للقراءة من stdin. يعيد false إذا تعذر فتح الإدخال
+// أو كان رقم الخوارزمية غير صحيح أو جاءت عملية بوقت وصول أقدم من سابقتها
+bool stream_run(int algorithm_id, int time_quantum, const char* filename, FILE* out) {
+    ProcessStream input;
+    if (!process_stream_open(filename, input)) {
+        return false;
+    }
+
+    JsonWriter writer = json_writer_to_file(out);
+    OnlineSink sink = {stream_write_segment, stream_write_complete, &writer};
+    OnlineScheduler* scheduler = online_create(algorithm_id, time_quantum, sink);
+    if (!scheduler) {
+        cerr << "Error: --stream needs --algo 1-6" << endl;
+        json_writer_destroy(writer);
+        process_stream_close(input);
+        return false;
+    }
+
+    bool ok = true;
+    Process process;
+    while (process_stream_next(input, process)) {
+        if (!online_submit(scheduler, process)) {
+            cerr << "Error: process " << process.id << " arrives at " << process.arrival_time
+                 << ", before the previous process (input must be sorted by arrival)" << endl;
+            ok = false;
+            break;
+        }
+    }
+
+    // كل ما وصل قبل الخطأ يُكمل تنفيذه
+    online_finish(scheduler);
+    stream_write_summary(writer, scheduler);
+
+    online_destroy(scheduler);
+    json_writer_destroy(writer);
+    fflush(out);
+    process_stream_close(input);
+    return ok;
+}
+
+#endif // STREAM_CPP_INCLUDED
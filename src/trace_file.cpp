@@ -0,0 +1,150 @@
+/**
+ * @file trace_file.cpp
+ * @brief Binary columnar workload format (.trace)
+ *
+ * Layout (little-endian):
+ *   header  : magic "CPUT", uint32 version, uint64 count       (16 bytes)
+ *   columns : int32 id[count], int32 arrival[count],
+ *             int32 burst[count], int32 priority[count]
+ *
+ * The file is memory-mapped and its columns are used in place, so opening
+ * a trace costs one mmap regardless of its size. The only per-process
+ * work is copying the four columns into Process[] for the algorithms.
+ */
+
+#ifndef TRACE_FILE_CPP_INCLUDED
+#define TRACE_FILE_CPP_INCLUDED
+
+#include "types.cpp"
+#include "mapped_file.cpp"
+#include <climits>
+#include <cstdint>
+
+using namespace std;
+
+// ==========================================
+// Format
+// ==========================================
+const char TRACE_MAGIC[4] = {'C', 'P', 'U', 'T'};
+const uint32_t TRACE_VERSION = 1;
+const int TRACE_COLUMNS = 4;
+
+struct TraceHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t count;
+};
+
+// Read-only view of an open trace
+struct MappedTrace {
+    int count;
+    const int32_t* id;
+    const int32_t* arrival_time;
+    const int32_t* burst_time;
+    const int32_t* priority;
+    MappedFile file;
+};
+
+// ==========================================
+// Detection
+// ==========================================
+
+// True if the file starts with the trace magic
+bool trace_is_binary(const char* filename) {
+    FILE* file = fopen(filename, "rb");
+    if (!file) return false;
+    char magic[4];
+    bool binary = fread(magic, 1, 4, file) == 4 && memcmp(magic, TRACE_MAGIC, 4) == 0;
+    fclose(file);
+    return binary;
+}
+
+// ==========================================
+// Open / Close
+// ==========================================
+
+// Map the file and point the columns into it. Returns false (with an error
+// printed) if the file is missing, too short, or not a version 1 trace.
+bool trace_open(const char* filename, MappedTrace& trace) {
+    memset(&trace, 0, sizeof(trace));
+    if (!file_map(filename, trace.file)) {
+        cout << "Error: Cannot open file " << filename << endl;
+        return false;
+    }
+
+    const TraceHeader* header = (const TraceHeader*)trace.file.data;
+    size_t size = trace.file.size;
+    if (size < sizeof(TraceHeader) || memcmp(header->magic, TRACE_MAGIC, 4) != 0 ||
+        header->version != TRACE_VERSION || header->count > (uint64_t)INT_MAX ||
+        size < sizeof(TraceHeader) + header->count * sizeof(int32_t) * TRACE_COLUMNS) {
+        cout << "Error: Not a valid trace file " << filename << endl;
+        file_unmap(trace.file);
+        return false;
+    }
+
+    trace.count = (int)header->count;
+    const int32_t* columns = (const int32_t*)(header + 1);
+    trace.id = columns;
+    trace.arrival_time = columns + trace.count;
+    trace.burst_time = columns + 2 * (size_t)trace.count;
+    trace.priority = columns + 3 * (size_t)trace.count;
+    return true;
+}
+
+void trace_close(MappedTrace& trace) {
+    file_unmap(trace.file);
+    trace.count = 0;
+}
+
+// ==========================================
+// Conversion
+// ==========================================
+
+// Copy the columns into a malloc'd Process[] (caller frees)
+Process* trace_to_processes(const MappedTrace& trace) {
+    Process* processes = (Process*)malloc(sizeof(Process) * (trace.count > 0 ? trace.count : 1));
+    for (int i = 0; i < trace.count; i++) {
+        processes[i] = create_process(trace.id[i], trace.arrival_time[i], trace.burst_time[i], trace.priority[i]);
+    }
+    return processes;
+}
+
+// Write processes as a trace file. Returns false if the file cannot be written.
+bool trace_write(const char* filename, const Process processes[], int count) {
+    FILE* file = fopen(filename, "wb");
+    if (!file) {
+        cout << "Error: Cannot create file " << filename << endl;
+        return false;
+    }
+
+    TraceHeader header;
+    memcpy(header.magic, TRACE_MAGIC, 4);
+    header.version = TRACE_VERSION;
+    header.count = (uint64_t)count;
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+
+    // One column at a time, through a fixed buffer
+    const int CHUNK = 4096;
+    int32_t buffer[CHUNK];
+    for (int column = 0; column < TRACE_COLUMNS && ok; column++) {
+        for (int start = 0; start < count && ok; start += CHUNK) {
+            int n = (count - start < CHUNK) ? count - start : CHUNK;
+            for (int k = 0; k < n; k++) {
+                const Process& p = processes[start + k];
+                buffer[k] = (column == 0) ? p.id
+                          : (column == 1) ? p.arrival_time
+                          : (column == 2) ? p.burst_time
+                          : p.priority;
+            }
+            ok = fwrite(buffer, sizeof(int32_t), n, file) == (size_t)n;
+        }
+    }
+
+    if (fclose(file) != 0) ok = false;
+    if (!ok) {
+        cout << "Error: Cannot write file " << filename << endl;
+    }
+    return ok;
+}
+
+#endif // TRACE_FILE_CPP_INCLUDED
@@ -6,6 +6,8 @@
 #ifndef TYPES_CPP_INCLUDED
 #define TYPES_CPP_INCLUDED
 
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 
 using namespace std;
@@ -13,8 +15,6 @@ using namespace std;
 // ==========================================
 // Constants
 // ==========================================
-const int MAX_PROCESSES = 100;
-const int MAX_TIMELINE = 1000;
 const int DEFAULT_TIME_QUANTUM = 2;
 
 // ==========================================
@@ -40,20 +40,48 @@ struct ExecutionRecord {
     int process_id;
     int start_time;
     int end_time;
+    int cpu_id;             // 0 on a single CPU
+};
+
+// ==========================================
+// Process Table (Structure of Arrays)
+// ==========================================
+// Same fields as Process, one contiguous column per field, so a scan that
+// only needs arrival_time and one key touches only those columns.
+// All columns live in a single allocation.
+struct ProcessTable {
+    int count;
+    int* id;
+    int* arrival_time;
+    int* burst_time;
+    int* priority;
+    int* remaining_time;
+    int* waiting_time;
+    int* turnaround_time;
+    int* completion_time;
+    int* start_time;
+    unsigned char* is_completed;
 };
 
 // ==========================================
 // Scheduling Result
 // ==========================================
+// processes, timeline and cpu_utilizations are heap buffers owned by the
+// result. Returning a result by value only copies the header, so ownership
+// moves to the caller, who must release it with result_destroy().
 struct SchedulingResult {
     char algorithm_name[64];
-    Process processes[MAX_PROCESSES];
+    Process* processes;
     int process_count;
-    ExecutionRecord timeline[MAX_TIMELINE];
+    ExecutionRecord* timeline;
     int timeline_length;
+    int timeline_capacity;
     double avg_waiting_time;
     double avg_turnaround_time;
-    double cpu_utilization;
+    double cpu_utilization;         // average over all CPUs
+    int cpu_count;
+    double* cpu_utilizations;       // per CPU, filled only when cpu_count > 1
+    double load_imbalance;          // busiest CPU above the mean, in percent
 };
 
 // ==========================================
@@ -86,4 +114,161 @@ void reset_process(Process& p) {
     p.is_completed = false;
 }
 
+// ==========================================
+// Process Table Functions
+// ==========================================
+
+// Create an empty table with room for count processes
+ProcessTable process_table_create(int count) {
+    const int INT_COLUMNS = 9;
+    int rows = (count > 0) ? count : 1;
+    int* block = (int*)malloc((sizeof(int) * INT_COLUMNS + sizeof(unsigned char)) * rows);
+    
+    ProcessTable table;
+    table.count = count;
+    table.id = block;
+    table.arrival_time = block + rows;
+    table.burst_time = block + 2 * rows;
+    table.priority = block + 3 * rows;
+    table.remaining_time = block + 4 * rows;
+    table.waiting_time = block + 5 * rows;
+    table.turnaround_time = block + 6 * rows;
+    table.completion_time = block + 7 * rows;
+    table.start_time = block + 8 * rows;
+    table.is_completed = (unsigned char*)(block + INT_COLUMNS * rows);
+    return table;
+}
+
+// Convert Process[] (array of structs) to a table
+ProcessTable process_table_from_array(const Process processes[], int count) {
+    ProcessTable table = process_table_create(count);
+    for (int i = 0; i < count; i++) {
+        table.id[i] = processes[i].id;
+        table.arrival_time[i] = processes[i].arrival_time;
+        table.burst_time[i] = processes[i].burst_time;
+        table.priority[i] = processes[i].priority;
+        table.remaining_time[i] = processes[i].remaining_time;
+        table.waiting_time[i] = processes[i].waiting_time;
+        table.turnaround_time[i] = processes[i].turnaround_time;
+        table.completion_time[i] = processes[i].completion_time;
+        table.start_time[i] = processes[i].start_time;
+        table.is_completed[i] = processes[i].is_completed ? 1 : 0;
+    }
+    return table;
+}
+
+// Copy a table back into Process[] (must hold table.count entries)
+void process_table_to_array(const ProcessTable& table, Process processes[]) {
+    for (int i = 0; i < table.count; i++) {
+        processes[i].id = table.id[i];
+        processes[i].arrival_time = table.arrival_time[i];
+        processes[i].burst_time = table.burst_time[i];
+        processes[i].priority = table.priority[i];
+        processes[i].remaining_time = table.remaining_time[i];
+        processes[i].waiting_time = table.waiting_time[i];
+        processes[i].turnaround_time = table.turnaround_time[i];
+        processes[i].completion_time = table.completion_time[i];
+        processes[i].start_time = table.start_time[i];
+        processes[i].is_completed = table.is_completed[i] != 0;
+    }
+}
+
+// Release the table columns
+void process_table_destroy(ProcessTable& table) {
+    free(table.id);
+    table.id = nullptr;
+    table.count = 0;
+}
+
+// ==========================================
+// Scheduling Result Functions
+// ==========================================
+
+// Create a result holding a reset copy of the input processes
+SchedulingResult result_create(const char* algorithm_name, const Process processes[], int count) {
+    SchedulingResult result;
+    strncpy(result.algorithm_name, algorithm_name, sizeof(result.algorithm_name) - 1);
+    result.algorithm_name[sizeof(result.algorithm_name) - 1] = '\0';
+    
+    result.processes = (Process*)malloc(sizeof(Process) * (count > 0 ? count : 1));
+    result.process_count = count;
+    for (int i = 0; i < count; i++) {
+        result.processes[i] = processes[i];
+        reset_process(result.processes[i]);
+    }
+    
+    result.timeline_capacity = (count > 0) ? count : 1;
+    result.timeline = (ExecutionRecord*)malloc(sizeof(ExecutionRecord) * result.timeline_capacity);
+    result.timeline_length = 0;
+    
+    result.avg_waiting_time = 0;
+    result.avg_turnaround_time = 0;
+    result.cpu_utilization = 0;
+    result.cpu_count = 1;
+    result.cpu_utilizations = nullptr;
+    result.load_imbalance = 0;
+    return result;
+}
+
+// Deep copy with buffers sized exactly (the copy is owned by the caller)
+SchedulingResult result_clone(const SchedulingResult& source) {
+    SchedulingResult copy = source;
+    int count = source.process_count;
+    int length = source.timeline_length;
+    copy.processes = (Process*)malloc(sizeof(Process) * (count > 0 ? count : 1));
+    memcpy(copy.processes, source.processes, sizeof(Process) * count);
+    copy.timeline_capacity = (length > 0) ? length : 1;
+    copy.timeline = (ExecutionRecord*)malloc(sizeof(ExecutionRecord) * copy.timeline_capacity);
+    memcpy(copy.timeline, source.timeline, sizeof(ExecutionRecord) * length);
+    if (source.cpu_utilizations) {
+        copy.cpu_utilizations = (double*)malloc(sizeof(double) * source.cpu_count);
+        memcpy(copy.cpu_utilizations, source.cpu_utilizations, sizeof(double) * source.cpu_count);
+    }
+    return copy;
+}
+
+// Release the buffers of a result (safe on a zero-initialized result)
+void result_destroy(SchedulingResult& result) {
+    free(result.processes);
+    free(result.timeline);
+    free(result.cpu_utilizations);
+    result.processes = nullptr;
+    result.timeline = nullptr;
+    result.cpu_utilizations = nullptr;
+    result.process_count = 0;
+    result.timeline_length = 0;
+    result.timeline_capacity = 0;
+}
+
+// ==========================================
+// Timeline Functions
+// ==========================================
+
+// Append an execution slice as a new record, growing the timeline as needed
+void push_execution_record(SchedulingResult& result, int process_id, int start, int end, int cpu_id = 0) {
+    if (result.timeline_length >= result.timeline_capacity) {
+        result.timeline_capacity = (result.timeline_capacity > 0) ? result.timeline_capacity * 2 : 16;
+        result.timeline = (ExecutionRecord*)realloc(result.timeline,
+                                                    sizeof(ExecutionRecord) * result.timeline_capacity);
+    }
+    result.timeline[result.timeline_length].process_id = process_id;
+    result.timeline[result.timeline_length].start_time = start;
+    result.timeline[result.timeline_length].end_time = end;
+    result.timeline[result.timeline_length].cpu_id = cpu_id;
+    result.timeline_length++;
+}
+
+// Append an execution slice, merging it into the previous record when the
+// same process simply keeps running on the same CPU (run-length coalescing)
+void append_execution_record(SchedulingResult& result, int process_id, int start, int end, int cpu_id = 0) {
+    if (result.timeline_length > 0) {
+        ExecutionRecord& last = result.timeline[result.timeline_length - 1];
+        if (last.process_id == process_id && last.cpu_id == cpu_id && last.end_time == start) {
+            last.end_time = end;
+            return;
+        }
+    }
+    push_execution_record(result, process_id, start, end, cpu_id);
+}
+
 #endif // TYPES_CPP_INCLUDED